@@ -0,0 +1,29 @@
+/**
+ * @file CombatRoundDTO.hpp
+ * @brief Заголовочный файл, содержащий определение структуры CombatRoundDTO
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct CombatRoundDTO
+ * @brief Структура DTO (Data Transfer Object) для передачи статистики одного раунда боя
+ */
+struct CombatRoundDTO {
+    size_t round = 0; ///< Номер раунда (с единицы)
+    size_t shots = 0; ///< Количество выстрелов
+    size_t hits = 0; ///< Количество попаданий
+    size_t misses = 0; ///< Количество промахов
+    size_t criticals = 0; ///< Количество критических попаданий
+    size_t kills = 0; ///< Количество потопленных кораблей (включая урон от взрыва)
+    double overkill = 0.0; ///< Урон сверх оставшегося здоровья целей
+    double convoy_damage = 0.0; ///< Урон, нанесенный конвоем
+    double pirate_damage = 0.0; ///< Урон, нанесенный пиратами
+    double cargo_lost = 0.0; ///< Потерянный конвоем груз
+    std::vector<std::pair<std::string, size_t>> ammo_used; ///< Израсходованные снаряды по типам оружия
+};
@@ -0,0 +1,23 @@
+/**
+ * @file EngagementDTO.hpp
+ * @brief Заголовочный файл, содержащий определение структуры EngagementDTO
+ */
+
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @struct EngagementDTO
+ * @brief Структура DTO (Data Transfer Object) для передачи итогов боя
+ */
+struct EngagementDTO {
+    size_t rounds = 0; ///< Количество проведенных раундов
+    size_t shots = 0; ///< Количество выполненных выстрелов
+    double damage_dealt = 0.0; ///< Суммарный нанесенный урон
+    double cargo_lost = 0.0; ///< Потерянный конвоем груз
+
+    size_t convoy_alive = 0; ///< Живые корабли конвоя после боя
+    size_t pirates_alive = 0; ///< Живые пиратские корабли после боя
+    bool stalemate = false; ///< Флаг боя, остановленного из-за того, что ни один корабль не может выстрелить
+};
@@ -0,0 +1,76 @@
+/**
+ * @file FleetSnapshot.hpp
+ * @brief Заголовочный файл, содержащий определение структуры FleetSnapshot
+ */
+
+#pragma once
+
+#include "../auxiliary/PlaceForWeapon.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @struct FleetWeaponRow
+ * @brief Строка плоской таблицы оружия в FleetSnapshot
+ */
+struct FleetWeaponRow {
+    PlaceForWeapon place; ///< Место установки оружия
+    uint32_t type; ///< Индекс типа оружия в пуле строк
+    uint32_t name; ///< Индекс названия оружия в пуле строк
+    double damage; ///< Урон оружия
+    double range; ///< Дальность стрельбы
+    size_t fire_rate; ///< Скорострельность
+    size_t max_ammo; ///< Максимальный боезапас
+    size_t current_ammo; ///< Текущий боезапас
+    double cost; ///< Стоимость оружия
+    double accuracy; ///< Точность оружия
+    double explosion_radius; ///< Радиус взрыва
+};
+
+/**
+ * @struct FleetSnapshot
+ * @brief Колоночный снимок группы кораблей для массовых запросов
+ * @details i-й корабль описывается i-ми элементами всех столбцов. Строки хранятся один раз в общем пуле,
+ * а столбцы содержат индексы в нем. Оружие i-го корабля занимает строки weapons[weapon_begin[i], weapon_begin[i + 1]).
+ */
+struct FleetSnapshot {
+    std::vector<std::string> strings; ///< Пул строк
+
+    std::vector<uint32_t> type; ///< Индексы типов кораблей в пуле строк
+    std::vector<uint32_t> id; ///< Индексы идентификаторов в пуле строк
+    std::vector<uint32_t> name; ///< Индексы названий в пуле строк
+    std::vector<uint32_t> captain_fio; ///< Индексы ФИО капитанов в пуле строк
+    std::vector<uint32_t> captain_rank; ///< Индексы званий капитанов в пуле строк
+
+    std::vector<double> max_speed; ///< Максимальные скорости
+    std::vector<double> current_speed; ///< Текущие скорости
+    std::vector<double> cost; ///< Стоимости
+    std::vector<double> position_x; ///< Координаты x
+    std::vector<double> position_y; ///< Координаты y
+    std::vector<double> max_health; ///< Максимальное здоровье
+    std::vector<double> current_health; ///< Текущее здоровье
+    std::vector<double> max_cargo; ///< Грузоподъемность (0 для кораблей без трюма)
+    std::vector<double> current_cargo; ///< Текущий груз
+    std::vector<double> speed_reduction_factor; ///< Коэффициенты снижения скорости от груза
+    std::vector<uint8_t> is_alive; ///< Флаги жизни
+    std::vector<uint8_t> is_convoy; ///< Флаги принадлежности к конвою
+
+    std::vector<uint32_t> weapon_begin; ///< Начало оружия каждого корабля в weapons (size() + 1 элементов)
+    std::vector<FleetWeaponRow> weapons; ///< Плоская таблица оружия
+
+    /**
+     * @brief Получает количество кораблей в снимке
+     * @return size_t Количество кораблей
+     */
+    size_t size() const { return id.size(); }
+
+    /**
+     * @brief Получает строку из пула по индексу
+     * @param ref Индекс строки
+     * @return std::string_view Строка
+     */
+    std::string_view str(uint32_t ref) const { return strings[ref]; }
+};
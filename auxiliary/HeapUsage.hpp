@@ -0,0 +1,34 @@
+/**
+ * @file HeapUsage.hpp
+ * @brief Заголовочный файл, содержащий функции подсчета памяти в куче, занятой стандартными контейнерами
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Получает объем памяти в куче, занятой строкой
+ * @details Короткие строки хранятся внутри объекта (SSO) и кучу не занимают
+ * @param str Строка
+ * @return size_t Объем памяти в байтах (вместимость с завершающим нулем или 0)
+ */
+inline size_t string_heap_usage(const std::string& str) {
+    const char* data = str.data();
+    const char* object = reinterpret_cast<const char*>(&str);
+    if (data >= object && data < object + sizeof(str)) return 0;
+    return str.capacity() + 1;
+}
+
+/**
+ * @brief Получает объем памяти в куче, занятой буфером вектора
+ * @tparam T Тип элементов
+ * @param vec Вектор
+ * @return size_t Объем памяти в байтах (вместимость, умноженная на размер элемента)
+ */
+template <typename T>
+size_t vector_heap_usage(const std::vector<T>& vec) {
+    return vec.capacity() * sizeof(T);
+}
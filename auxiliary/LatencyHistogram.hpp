@@ -0,0 +1,130 @@
+/**
+ * @file LatencyHistogram.hpp
+ * @brief Заголовочный файл, содержащий определение гистограммы задержек в стиле HDR
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * @class LatencyHistogram
+ * @brief Гистограмма задержек с логарифмически-линейными корзинами
+ * @details Значения до 32 нс хранятся точно, каждая следующая степень двойки делится на 16 равных корзин,
+ * поэтому относительная погрешность перцентилей не превышает 1/16 (около 6%) на всем диапазоне до ~9.7 часа.
+ * Запись — несколько атомарных операций с memory_order_relaxed без блокировок и выделения памяти,
+ * гистограмму можно читать одновременно с записью.
+ */
+class LatencyHistogram {
+    private:
+        static constexpr unsigned sub_bucket_bits = 4; ///< Количество бит мантиссы внутри степени двойки
+        static constexpr uint64_t sub_bucket_count = uint64_t(1) << sub_bucket_bits; ///< Количество корзин на степень двойки
+        static constexpr uint64_t linear_limit = sub_bucket_count * 2; ///< Граница точно хранимых значений
+        static constexpr unsigned max_shift = 40; ///< Максимальный сдвиг мантиссы
+        static constexpr size_t bucket_count = linear_limit + max_shift * sub_bucket_count; ///< Количество корзин
+
+        std::array<std::atomic<uint64_t>, bucket_count> buckets_{}; ///< Счетчики корзин
+        std::atomic<uint64_t> count_{0}; ///< Количество значений
+        std::atomic<uint64_t> total_{0}; ///< Сумма значений
+        std::atomic<uint64_t> max_{0}; ///< Максимальное значение
+
+        /**
+         * @brief Вычисляет индекс корзины для значения
+         * @param value Значение в наносекундах
+         * @return size_t Индекс корзины
+         */
+        static size_t bucket_index(uint64_t value) {
+            if (value < linear_limit) return static_cast<size_t>(value);
+            unsigned shift = static_cast<unsigned>(std::bit_width(value)) - sub_bucket_bits - 1;
+            if (shift > max_shift) return bucket_count - 1;
+            uint64_t mantissa = value >> shift;
+            return static_cast<size_t>(linear_limit + (shift - 1) * sub_bucket_count + (mantissa - sub_bucket_count));
+        }
+
+        /**
+         * @brief Вычисляет наибольшее значение, попадающее в корзину
+         * @param index Индекс корзины
+         * @return uint64_t Верхняя граница корзины в наносекундах
+         */
+        static uint64_t bucket_upper_bound(size_t index) {
+            if (index < linear_limit) return index;
+            uint64_t shift = (index - linear_limit) / sub_bucket_count + 1;
+            uint64_t mantissa = (index - linear_limit) % sub_bucket_count + sub_bucket_count;
+            return ((mantissa + 1) << shift) - 1;
+        }
+    public:
+        /**
+         * @brief Записывает значение
+         * @param nanoseconds Задержка в наносекундах
+         */
+        void record(uint64_t nanoseconds) {
+            buckets_[bucket_index(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+            count_.fetch_add(1, std::memory_order_relaxed);
+            total_.fetch_add(nanoseconds, std::memory_order_relaxed);
+            uint64_t current = max_.load(std::memory_order_relaxed);
+            while (nanoseconds > current && !max_.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed)) {}
+        }
+
+        /**
+         * @brief Получает количество значений
+         * @return uint64_t Количество значений
+         */
+        uint64_t count() const {
+            return count_.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Получает максимальное значение
+         * @return uint64_t Максимальная задержка в наносекундах
+         */
+        uint64_t max() const {
+            return max_.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Получает среднее значение
+         * @return double Средняя задержка в наносекундах (0, если значений нет)
+         */
+        double mean() const {
+            uint64_t n = count();
+            return n ? static_cast<double>(total_.load(std::memory_order_relaxed)) / static_cast<double>(n) : 0.0;
+        }
+
+        /**
+         * @brief Вычисляет перцентиль
+         * @param percent Перцентиль от 0 до 100
+         * @return uint64_t Верхняя граница корзины, в которую попадает перцентиль (не больше максимума), в наносекундах
+         */
+        uint64_t percentile(double percent) const {
+            uint64_t n = count();
+            if (n == 0) return 0;
+            if (percent < 0.0) percent = 0.0;
+            if (percent > 100.0) percent = 100.0;
+            uint64_t rank = static_cast<uint64_t>(std::ceil(percent / 100.0 * static_cast<double>(n)));
+            if (rank == 0) rank = 1;
+            uint64_t seen = 0;
+            for (size_t i = 0; i < bucket_count; ++i) {
+                seen += buckets_[i].load(std::memory_order_relaxed);
+                if (seen >= rank) {
+                    uint64_t bound = bucket_upper_bound(i);
+                    uint64_t maximum = max();
+                    return bound < maximum ? bound : maximum;
+                }
+            }
+            return max();
+        }
+
+        /**
+         * @brief Обнуляет гистограмму
+         */
+        void clear() {
+            for (auto& bucket : buckets_) bucket.store(0, std::memory_order_relaxed);
+            count_.store(0, std::memory_order_relaxed);
+            total_.store(0, std::memory_order_relaxed);
+            max_.store(0, std::memory_order_relaxed);
+        }
+};
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "HeapUsage.hpp"
 #include <string>
 
 /**
@@ -35,4 +36,12 @@ struct Military {
     bool operator==(const Military& other) const {
         return FIO == other.FIO && rank == other.rank;
     }
+
+    /**
+     * @brief Получает объем памяти в куче, занятой строками
+     * @return size_t Объем памяти в байтах
+     */
+    size_t heap_usage() const {
+        return string_heap_usage(FIO) + string_heap_usage(rank);
+    }
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "../template/DenseEnum.hpp"
+
 /**
  * @enum PlaceForWeapon
  * @brief Перечисление, представляющее возможные места для установки оружия на корабле
@@ -14,4 +16,10 @@ enum PlaceForWeapon {
     bow, ///< Нос
     starboard, ///< Правый борт
     port ///< Левый борт
-};
\ No newline at end of file
+};
+
+/**
+ * @brief Количество мест для оружия (используется LookupTable для прямой индексации)
+ */
+template <>
+struct dense_enum_size<PlaceForWeapon> : std::integral_constant<size_t, 4> {};
@@ -0,0 +1,378 @@
+/**
+ * @file Tracer.hpp
+ * @brief Заголовочный файл, содержащий определение трассировки горячих путей в формате Chrome trace_event
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @struct TraceEvent
+ * @brief Событие трассировки: завершенный интервал или значение счетчика
+ */
+struct TraceEvent {
+    const char* category = ""; ///< Категория (строковый литерал)
+    const char* name = ""; ///< Название (строковый литерал)
+    int64_t timestamp_ns = 0; ///< Время начала от запуска трассировки в наносекундах
+    int64_t duration_ns = 0; ///< Длительность интервала в наносекундах
+    double value = 0.0; ///< Значение счетчика
+    char phase = 'X'; ///< Фаза события: 'X' для интервала, 'C' для счетчика
+};
+
+/**
+ * @class TraceBuffer
+ * @brief Буфер событий одного потока
+ * @details Пишет только поток-владелец, без блокировок: событие записывается в ячейку блока,
+ * после чего размер блока публикуется атомарно. Читатель видит только опубликованные события, поэтому
+ * буфер можно выгружать, не останавливая потоки. Блоки не перемещаются и не освобождаются до уничтожения буфера.
+ */
+class TraceBuffer {
+    private:
+        static constexpr size_t chunk_size = 1024; ///< Количество событий в одном блоке
+        static constexpr size_t max_events = size_t(1) << 20; ///< Максимальное количество событий в буфере, лишние отбрасываются
+
+        /**
+         * @struct Chunk
+         * @brief Блок событий
+         */
+        struct Chunk {
+            std::array<TraceEvent, chunk_size> events; ///< События
+            std::atomic<size_t> size{0}; ///< Количество опубликованных событий
+            std::atomic<Chunk*> next{nullptr}; ///< Следующий блок
+        };
+
+        std::unique_ptr<Chunk> head_; ///< Первый блок
+        Chunk* tail_; ///< Блок, в который идет запись (используется только владельцем)
+        size_t recorded_ = 0; ///< Количество записанных событий (используется только владельцем)
+        std::atomic<size_t> dropped_{0}; ///< Количество отброшенных событий
+        uint32_t thread_id_; ///< Номер потока в трассе
+
+    public:
+        /**
+         * @brief Конструктор
+         * @param thread_id Номер потока в трассе
+         */
+        explicit TraceBuffer(uint32_t thread_id) : head_(std::make_unique<Chunk>()), tail_(head_.get()), thread_id_(thread_id) {}
+
+        TraceBuffer(const TraceBuffer&) = delete;
+        TraceBuffer& operator=(const TraceBuffer&) = delete;
+
+        /**
+         * @brief Деструктор (освобождает цепочку блоков)
+         */
+        ~TraceBuffer() {
+            Chunk* chunk = head_->next.load(std::memory_order_relaxed);
+            while (chunk) {
+                Chunk* next = chunk->next.load(std::memory_order_relaxed);
+                delete chunk;
+                chunk = next;
+            }
+        }
+
+        /**
+         * @brief Добавляет событие (вызывается только потоком-владельцем)
+         * @param event Событие
+         */
+        void push(const TraceEvent& event) {
+            if (recorded_ >= max_events) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            size_t size = tail_->size.load(std::memory_order_relaxed);
+            if (size == chunk_size) {
+                Chunk* chunk = new Chunk();
+                tail_->next.store(chunk, std::memory_order_release);
+                tail_ = chunk;
+                size = 0;
+            }
+            tail_->events[size] = event;
+            tail_->size.store(size + 1, std::memory_order_release);
+            ++recorded_;
+        }
+
+        /**
+         * @brief Обходит опубликованные события
+         * @tparam Function Тип обработчика
+         * @param function Обработчик события
+         */
+        template <typename Function>
+        void for_each(Function&& function) const {
+            for (const Chunk* chunk = head_.get(); chunk; chunk = chunk->next.load(std::memory_order_acquire)) {
+                size_t size = chunk->size.load(std::memory_order_acquire);
+                for (size_t i = 0; i < size; ++i) function(chunk->events[i]);
+                if (size < chunk_size) break;
+            }
+        }
+
+        /**
+         * @brief Получает номер потока в трассе
+         * @return uint32_t Номер потока
+         */
+        uint32_t get_thread_id() const {
+            return thread_id_;
+        }
+
+        /**
+         * @brief Получает количество отброшенных событий
+         * @return size_t Количество отброшенных событий
+         */
+        size_t get_dropped() const {
+            return dropped_.load(std::memory_order_relaxed);
+        }
+};
+
+/**
+ * @class Tracer
+ * @brief Единый журнал трассировки процесса
+ * @details Каждый поток при первом событии получает собственный TraceBuffer (единственная блокировка),
+ * дальнейшая запись идет без блокировок. При завершении потока буфер переходит следующему новому потоку,
+ * а не освобождается, поэтому события потоков, завершившихся раньше выгрузки, не теряются, а память
+ * ограничена max_events на каждый одновременно работающий поток. Выгрузка в формате Chrome trace_event открывается в Perfetto и chrome://tracing.
+ */
+class Tracer {
+    private:
+        mutable std::mutex mutex_; ///< Мьютекс списка буферов
+        std::vector<std::unique_ptr<TraceBuffer>> buffers_; ///< Буферы потоков
+        std::vector<TraceBuffer*> free_buffers_; ///< Буферы завершившихся потоков, готовые к повторному использованию
+        std::chrono::steady_clock::time_point start_ = std::chrono::steady_clock::now(); ///< Момент запуска трассировки
+
+        /**
+         * @struct LocalBuffer
+         * @brief Владелец буфера на время жизни потока
+         * @details При завершении потока возвращает буфер в список свободных, поэтому количество буферов
+         * ограничено наибольшим числом одновременно пишущих потоков, а не числом когда-либо запущенных.
+         */
+        struct LocalBuffer {
+            TraceBuffer* buffer = nullptr; ///< Буфер потока
+
+            /**
+             * @brief Деструктор (возвращает буфер журналу)
+             */
+            ~LocalBuffer() {
+                if (buffer) Tracer::instance().release_buffer(buffer);
+            }
+        };
+
+        Tracer() = default;
+
+        /**
+         * @brief Выдает буфер текущему потоку: свободный буфер завершившегося потока или новый
+         * @details Передача буфера идет под мьютексом, поэтому у буфера по-прежнему один писатель в каждый момент времени
+         * @return TraceBuffer* Указатель на буфер
+         */
+        TraceBuffer* acquire_buffer() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!free_buffers_.empty()) {
+                TraceBuffer* buffer = free_buffers_.back();
+                free_buffers_.pop_back();
+                return buffer;
+            }
+            buffers_.push_back(std::make_unique<TraceBuffer>(static_cast<uint32_t>(buffers_.size() + 1)));
+            return buffers_.back().get();
+        }
+
+        /**
+         * @brief Возвращает буфер завершившегося потока (события буфера сохраняются до выгрузки)
+         * @param buffer Указатель на буфер
+         */
+        void release_buffer(TraceBuffer* buffer) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            free_buffers_.push_back(buffer);
+        }
+
+        /**
+         * @brief Получает буфер текущего потока
+         * @return TraceBuffer& Ссылка на буфер
+         */
+        TraceBuffer& local_buffer() {
+            thread_local LocalBuffer local;
+            if (!local.buffer) local.buffer = acquire_buffer();
+            return *local.buffer;
+        }
+
+        /**
+         * @brief Записывает строку в JSON с экранированием
+         * @param out Поток вывода
+         * @param str Строка
+         */
+        static void write_json_string(std::ostream& out, const char* str) {
+            out << '"';
+            for (const char* c = str; *c; ++c) {
+                if (*c == '"' || *c == '\\') out << '\\';
+                out << *c;
+            }
+            out << '"';
+        }
+    public:
+        Tracer(const Tracer&) = delete;
+        Tracer& operator=(const Tracer&) = delete;
+
+        /**
+         * @brief Получает журнал трассировки процесса
+         * @return Tracer& Ссылка на журнал
+         */
+        static Tracer& instance() {
+            static Tracer tracer;
+            return tracer;
+        }
+
+        /**
+         * @brief Получает время от запуска трассировки
+         * @return int64_t Время в наносекундах
+         */
+        int64_t now() const {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count();
+        }
+
+        /**
+         * @brief Записывает завершенный интервал
+         * @param category Категория (строковый литерал)
+         * @param name Название (строковый литерал)
+         * @param start Время начала в наносекундах
+         * @param duration Длительность в наносекундах
+         */
+        void complete(const char* category, const char* name, int64_t start, int64_t duration) {
+            local_buffer().push(TraceEvent{category, name, start, duration, 0.0, 'X'});
+        }
+
+        /**
+         * @brief Записывает значение счетчика
+         * @param category Категория (строковый литерал)
+         * @param name Название (строковый литерал)
+         * @param value Значение
+         */
+        void counter(const char* category, const char* name, double value) {
+            local_buffer().push(TraceEvent{category, name, now(), 0, value, 'C'});
+        }
+
+        /**
+         * @brief Получает количество записанных событий во всех потоках
+         * @return size_t Количество событий
+         */
+        size_t event_count() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            size_t count = 0;
+            for (const auto& buffer : buffers_) buffer->for_each([&count](const TraceEvent&) { ++count; });
+            return count;
+        }
+
+        /**
+         * @brief Получает количество буферов (не больше наибольшего числа одновременно писавших потоков)
+         * @return size_t Количество буферов
+         */
+        size_t buffer_count() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return buffers_.size();
+        }
+
+        /**
+         * @brief Получает количество событий, отброшенных из-за переполнения буферов
+         * @return size_t Количество отброшенных событий
+         */
+        size_t dropped_count() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            size_t count = 0;
+            for (const auto& buffer : buffers_) count += buffer->get_dropped();
+            return count;
+        }
+
+        /**
+         * @brief Выгружает все события в формате Chrome trace_event JSON
+         * @param out Поток вывода
+         */
+        void write_chrome_trace(std::ostream& out) const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+            bool first = true;
+            for (const auto& buffer : buffers_) {
+                uint32_t tid = buffer->get_thread_id();
+                buffer->for_each([&](const TraceEvent& event) {
+                    if (!first) out << ',';
+                    first = false;
+                    out << "{\"name\":";
+                    write_json_string(out, event.name);
+                    out << ",\"cat\":";
+                    write_json_string(out, event.category);
+                    out << ",\"ph\":\"" << event.phase << "\",\"pid\":1,\"tid\":" << tid
+                        << ",\"ts\":" << static_cast<double>(event.timestamp_ns) / 1000.0;
+                    if (event.phase == 'X') out << ",\"dur\":" << static_cast<double>(event.duration_ns) / 1000.0;
+                    else out << ",\"args\":{\"value\":" << event.value << '}';
+                    out << '}';
+                });
+            }
+            out << "]}";
+        }
+
+        /**
+         * @brief Сохраняет трассу в файл
+         * @param path Путь к файлу
+         * @return bool true если файл записан, false в противном случае
+         */
+        bool save_chrome_trace(const std::string& path) const {
+            std::ofstream file(path);
+            if (!file.is_open()) return false;
+            write_chrome_trace(file);
+            return static_cast<bool>(file);
+        }
+};
+
+/**
+ * @class TraceSpan
+ * @brief Интервал трассировки, охватывающий область видимости
+ */
+class TraceSpan {
+    private:
+        const char* category_; ///< Категория
+        const char* name_; ///< Название
+        int64_t start_; ///< Время начала в наносекундах
+
+    public:
+        /**
+         * @brief Конструктор (запоминает время начала)
+         * @param category Категория (строковый литерал)
+         * @param name Название (строковый литерал)
+         */
+        TraceSpan(const char* category, const char* name) : category_(category), name_(name), start_(Tracer::instance().now()) {}
+
+        TraceSpan(const TraceSpan&) = delete;
+        TraceSpan& operator=(const TraceSpan&) = delete;
+
+        /**
+         * @brief Деструктор (записывает интервал в буфер потока)
+         */
+        ~TraceSpan() {
+            Tracer& tracer = Tracer::instance();
+            tracer.complete(category_, name_, start_, tracer.now() - start_);
+        }
+};
+
+#define PIRATE_TRACE_CONCAT_IMPL(a, b) a##b
+#define PIRATE_TRACE_CONCAT(a, b) PIRATE_TRACE_CONCAT_IMPL(a, b)
+
+/**
+ * @def TRACE_SPAN(category, name)
+ * @brief Открывает интервал трассировки до конца текущей области видимости
+ * @details Без PIRATE_TRACING (опция CMake) макрос ничего не генерирует
+ */
+/**
+ * @def TRACE_COUNTER(category, name, value)
+ * @brief Записывает значение счетчика в трассу
+ * @details Без PIRATE_TRACING (опция CMake) макрос ничего не генерирует, и value не вычисляется
+ */
+#ifdef PIRATE_TRACING
+    #define TRACE_SPAN(category, name) TraceSpan PIRATE_TRACE_CONCAT(trace_span_, __LINE__)(category, name)
+    #define TRACE_COUNTER(category, name, value) Tracer::instance().counter(category, name, static_cast<double>(value))
+#else
+    #define TRACE_SPAN(category, name) ((void)0)
+    #define TRACE_COUNTER(category, name, value) ((void)0)
+#endif
@@ -1,6 +1,8 @@
 #include "DefaultGuard.hpp"
+#include <algorithm>
+#include <numeric>
 
-IWeapon* DefaultGuard::get_weapon_in_place(PlaceForWeapon place) const {
+const IWeapon* DefaultGuard::get_weapon_in_place(PlaceForWeapon place) const {
     auto it = weapons_.find(place);
     if (it != weapons_.end()) return it->second.get();
     return nullptr;
@@ -8,12 +10,13 @@ IWeapon* DefaultGuard::get_weapon_in_place(PlaceForWeapon place) const {
 
 void DefaultGuard::set_weapon_in_place(PlaceForWeapon place, std::unique_ptr<IWeapon> weapon) {
     if (!weapon) return;
-    remove_weapon_from_place(place);
+    weapons_.erase(place);
     weapons_[place] = std::move(weapon);
+    refresh_weapon_profile();
 }
 
 void DefaultGuard::remove_weapon_from_place(PlaceForWeapon place) {
-    weapons_.erase(place);
+    if (weapons_.erase(place)) refresh_weapon_profile();
 }
 
 size_t DefaultGuard::get_weapon_count() const {
@@ -30,4 +33,73 @@ double DefaultGuard::get_max_range() const {
         if (weapon) max_range = std::max(max_range, weapon->get_range());
     }
     return max_range;
+}
+
+void DefaultGuard::refresh_weapon_profile() {
+    std::array<WeaponSlotProfile, max_slots> loaded{};
+    size_t count = 0;
+    for (auto place : {PlaceForWeapon::bow, PlaceForWeapon::stern, PlaceForWeapon::port, PlaceForWeapon::starboard}) {
+        const IWeapon* weapon = get_weapon_in_place(place);
+        if (!weapon || weapon->get_current_ammo() == 0) continue;
+        double damage = weapon->get_damage();
+        loaded[count++] = {place, damage, damage * weapon->get_fire_rate(), weapon->get_range()};
+    }
+
+    std::array<uint8_t, max_slots> dps_order{};
+    std::array<uint8_t, max_slots> damage_order{};
+    std::iota(dps_order.begin(), dps_order.begin() + count, uint8_t(0));
+    std::iota(damage_order.begin(), damage_order.begin() + count, uint8_t(0));
+    std::stable_sort(dps_order.begin(), dps_order.begin() + count, [&loaded](uint8_t a, uint8_t b) {
+        return loaded[a].dps > loaded[b].dps;
+    });
+    std::stable_sort(damage_order.begin(), damage_order.begin() + count, [&loaded](uint8_t a, uint8_t b) {
+        return loaded[a].damage > loaded[b].damage;
+    });
+
+    std::array<uint8_t, max_slots> dps_position{};
+    for (size_t i = 0; i < count; ++i) {
+        by_dps_[i] = loaded[dps_order[i]];
+        dps_position[dps_order[i]] = static_cast<uint8_t>(i);
+    }
+    for (size_t i = 0; i < count; ++i) by_damage_[i] = dps_position[damage_order[i]];
+    profile_size_ = static_cast<uint8_t>(count);
+}
+
+bool DefaultGuard::consume_ammo(PlaceForWeapon place) {
+    auto it = weapons_.find(place);
+    if (it == weapons_.end() || !it->second) return false;
+    size_t current_ammo = it->second->get_current_ammo();
+    if (current_ammo == 0) return false;
+    it->second->set_current_ammo(current_ammo - 1);
+    if (current_ammo == 1) refresh_weapon_profile();
+    return true;
+}
+
+double DefaultGuard::get_loaded_range() const {
+    double range = 0.0;
+    for (size_t i = 0; i < profile_size_; ++i) range = std::max(range, by_dps_[i].range);
+    return range;
+}
+
+std::optional<PlaceForWeapon> DefaultGuard::best_place_by_dps(double distance) const {
+    for (size_t i = 0; i < profile_size_ && by_dps_[i].dps > 0.0; ++i) {
+        if (by_dps_[i].range >= distance) return by_dps_[i].place;
+    }
+    return std::nullopt;
+}
+
+std::optional<PlaceForWeapon> DefaultGuard::best_place_by_damage(double distance) const {
+    for (size_t i = 0; i < profile_size_ && by_dps_[by_damage_[i]].damage > 0.0; ++i) {
+        const WeaponSlotProfile& profile = by_dps_[by_damage_[i]];
+        if (profile.range >= distance) return profile.place;
+    }
+    return std::nullopt;
+}
+
+size_t DefaultGuard::weapons_memory_usage() const {
+    size_t bytes = 0;
+    for (const auto& [place, weapon] : weapons_) {
+        if (weapon) bytes += weapon->memory_usage();
+    }
+    return bytes;
 }
\ No newline at end of file
@@ -8,14 +8,39 @@
 #include "../Interfaces/IGuard.hpp"
 #include "../../../auxiliary/PlaceForWeapon.hpp"
 #include "../../../template/LookupTable.hpp"
+#include <array>
+#include <cstdint>
+#include <optional>
 
 /**
  * @class DefaultGuard
  * @brief Реализация базовой функциональности вооружения корабля
+ * @details Хранит профиль заряженного оружия, чтобы выбор оружия для выстрела не обходил карту оружия.
+ * Профиль хранится один раз: записи по местам установки и порядок по урону в однобайтовых индексах.
+ * Установленное оружие изменяется только через методы этого класса, поэтому профиль не устаревает.
  */
 class DefaultGuard : public IGuard {
+    public:
+        /**
+         * @struct WeaponSlotProfile
+         * @brief Характеристики оружия, установленного в одном месте
+         */
+        struct WeaponSlotProfile {
+            PlaceForWeapon place; ///< Место установки
+            double damage; ///< Урон
+            double dps; ///< Урон в секунду
+            double range; ///< Дальность
+        };
+
     protected:
         LookupTable<PlaceForWeapon, std::unique_ptr<IWeapon>> weapons_; ///< Карта оружия по местам установки
+
+    private:
+        static constexpr size_t max_slots = dense_enum_size<PlaceForWeapon>::value; ///< Количество мест для оружия
+
+        std::array<WeaponSlotProfile, max_slots> by_dps_{}; ///< Оружие с боезапасом, отсортированное по убыванию DPS
+        std::array<uint8_t, max_slots> by_damage_{}; ///< Индексы записей by_dps_ в порядке убывания урона
+        uint8_t profile_size_ = 0; ///< Количество заполненных записей профиля
     public:
         /**
          * @brief Конструктор по умолчанию
@@ -27,7 +52,7 @@ class DefaultGuard : public IGuard {
          */
         ~DefaultGuard() override = default;
 
-        IWeapon* get_weapon_in_place(PlaceForWeapon place) const override;
+        const IWeapon* get_weapon_in_place(PlaceForWeapon place) const override;
         void set_weapon_in_place(PlaceForWeapon place, std::unique_ptr<IWeapon> weapon) override;
         void remove_weapon_from_place(PlaceForWeapon place) override;
         size_t get_weapon_count() const override;
@@ -38,4 +63,59 @@ class DefaultGuard : public IGuard {
          * @return double Максимальная дальность или 0.0 если оружия нет
          */
         double get_max_range() const;
+
+        /**
+         * @brief Получает объем памяти, занятой установленным оружием
+         * @return size_t Объем памяти в байтах
+         */
+        size_t weapons_memory_usage() const;
+
+        /**
+         * @brief Получает максимальную дальность среди заряженного оружия (по профилю вооружения)
+         * @return double Максимальная дальность или 0.0 если заряженного оружия нет
+         */
+        double get_loaded_range() const;
+
+        /**
+         * @brief Пересчитывает профиль вооружения
+         * @details Вызывается при установке, снятии и изменении оружия, а также при исчерпании боезапаса
+         */
+        void refresh_weapon_profile();
+
+        /**
+         * @brief Расходует один снаряд оружия и пересчитывает профиль, если боезапас исчерпан
+         * @param place Место установки
+         * @return bool true если снаряд израсходован, false если оружия нет или оно не заряжено
+         */
+        bool consume_ammo(PlaceForWeapon place);
+
+        /**
+         * @brief Изменяет установленное оружие и пересчитывает профиль вооружения
+         * @tparam Modifier Тип функции, принимающей IWeapon&
+         * @param place Место установки
+         * @param modify Функция изменения оружия
+         * @return bool true если оружие найдено и изменено, false в противном случае
+         */
+        template <typename Modifier>
+        bool modify_weapon_in_place(PlaceForWeapon place, Modifier&& modify) {
+            auto it = weapons_.find(place);
+            if (it == weapons_.end() || !it->second) return false;
+            modify(*it->second);
+            refresh_weapon_profile();
+            return true;
+        }
+
+        /**
+         * @brief Выбирает место оружия с максимальным DPS, достающего до цели
+         * @param distance Расстояние до цели
+         * @return std::optional<PlaceForWeapon> Место установки или std::nullopt, если подходящего оружия нет
+         */
+        std::optional<PlaceForWeapon> best_place_by_dps(double distance) const;
+
+        /**
+         * @brief Выбирает место оружия с максимальным уроном, достающего до цели
+         * @param distance Расстояние до цели
+         * @return std::optional<PlaceForWeapon> Место установки или std::nullopt, если подходящего оружия нет
+         */
+        std::optional<PlaceForWeapon> best_place_by_damage(double distance) const;
 };
\ No newline at end of file
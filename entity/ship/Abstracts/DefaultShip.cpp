@@ -1,11 +1,12 @@
 #include "DefaultShip.hpp"
+#include "../../../auxiliary/HeapUsage.hpp"
 #include <stdexcept>
 #include <cmath>
 
 void DefaultShip::validate_parameters() const {
-    if (max_speed_ < 0.0) throw std::invalid_argument("Max speed must be positive");
-    if (max_health_ < 0.0) throw std::invalid_argument("Max health must be positive");
-    if (cost_ < 0.0) throw std::invalid_argument("Cost cannot be negative");
+    if (state_.max_speed < 0.0) throw std::invalid_argument("Max speed must be positive");
+    if (state_.max_health < 0.0) throw std::invalid_argument("Max health must be positive");
+    if (profile_->cost < 0.0) throw std::invalid_argument("Cost cannot be negative");
 }
 
 DefaultShip::DefaultShip(
@@ -17,38 +18,37 @@ DefaultShip::DefaultShip(
     const std::string& id,
     bool is_convoy,
     const Vector& position
-) : name_(name),
-    captain_(captain),
-    max_speed_(max_speed),
-    current_speed_(0.0),
-    cost_(cost),   
-    id_(id),
-    is_convoy_(is_convoy),
-    position_(position),
-    max_health_(max_health),
-    current_health_(max_health),
-    is_alive_(true) {
+) : profile_(std::make_unique<ShipProfile>()) {
+    state_.position = position;
+    state_.max_speed = max_speed;
+    state_.max_health = max_health;
+    state_.current_health.store(max_health, std::memory_order_relaxed);
+    state_.is_convoy = is_convoy;
+    profile_->name = name;
+    profile_->captain = captain;
+    profile_->id = id;
+    profile_->cost = cost;
     validate_parameters();
 }
 
 Vector DefaultShip::get_position() const {
-    return position_;
+    return state_.position;
 }
 void DefaultShip::set_position(const Vector& position) {
-    position_ = position;
+    state_.position = position;
 }
 double DefaultShip::get_speed() const {
-    return current_speed_;
+    return state_.current_speed;
 }
 void DefaultShip::set_speed(double speed) {
-    if (speed <= 0.0) current_speed_ = 0.0;
-    else if (speed < max_speed_) current_speed_ = speed;
-    else current_speed_ = max_speed_;
+    if (speed <= 0.0) state_.current_speed = 0.0;
+    else if (speed < state_.max_speed) state_.current_speed = speed;
+    else state_.current_speed = state_.max_speed;
 }
 
 double DefaultShip::get_distance_to(const Vector& point) const {
-    double dx = point.x - position_.x;
-    double dy = point.y - position_.y;
+    double dx = point.x - state_.position.x;
+    double dy = point.y - state_.position.y;
     return std::sqrt(dx * dx + dy * dy);
 }
 
@@ -57,37 +57,38 @@ bool DefaultShip::is_at_position(const Vector& pos, double tolerance) const {
 }
 
 double DefaultShip::get_health() const {
-    return current_health_.load(std::memory_order_acquire);
+    return state_.current_health.load(std::memory_order_acquire);
 }
 double DefaultShip::get_max_health() const {
-    return max_health_;
+    return state_.max_health;
 }
 bool DefaultShip::is_alive() const {
-    return is_alive_.load(std::memory_order_acquire);
+    return state_.is_alive.load(std::memory_order_acquire);
 }
 void DefaultShip::set_health(double health) {
     if (health < 0.0) health = 0.0;
-    if (health > max_health_) health = max_health_;
+    if (health > state_.max_health) health = state_.max_health;
     
-    current_health_.store(health, std::memory_order_release);
+    state_.current_health.store(health, std::memory_order_release);
     
-    if (health <= 0.0 || std::abs(health) < 1e-9) {
-        is_alive_.store(false, std::memory_order_release);
-        current_speed_ = 0.0;
-    }
-    else is_alive_.store(true, std::memory_order_release);
+    bool alive = !(health <= 0.0 || std::abs(health) < 1e-9);
+    if (!alive) state_.current_speed = 0.0;
+    bool was_alive = state_.is_alive.exchange(alive, std::memory_order_acq_rel);
+    if (!life_observer_ || was_alive == alive) return;
+    if (alive) life_observer_->on_revived(this);
+    else life_observer_->on_destroyed(this);
 }
 
 void DefaultShip::set_max_health(double max_health) {
     if (max_health < 0.0) throw std::invalid_argument("Max health must be positive");
-    max_health_ = max_health;
-    if (current_health_ > max_health_) current_health_ = max_health_;
+    state_.max_health = max_health;
+    if (state_.current_health > state_.max_health) state_.current_health = state_.max_health;
 }
 
 void DefaultShip::take_damage(double damage) {
-    if (!is_alive_.load(std::memory_order_acquire) || damage <= 0.0) return;
+    if (!state_.is_alive.load(std::memory_order_acquire) || damage <= 0.0) return;
     
-    double current = current_health_.load(std::memory_order_relaxed);
+    double current = state_.current_health.load(std::memory_order_relaxed);
     double desired;
     
     do {
@@ -95,53 +96,63 @@ void DefaultShip::take_damage(double damage) {
         desired = current - damage;
         if (desired < 0.0) desired = 0.0;
         
-    } while (!current_health_.compare_exchange_weak(current, desired, std::memory_order_release, std::memory_order_relaxed));
+    } while (!state_.current_health.compare_exchange_weak(current, desired, std::memory_order_release, std::memory_order_relaxed));
     
     if (desired == 0.0) {
         bool expected = true;
-        if (is_alive_.compare_exchange_strong(expected, false, std::memory_order_release, std::memory_order_relaxed)) {
-            current_speed_ = 0.0;
+        if (state_.is_alive.compare_exchange_strong(expected, false, std::memory_order_release, std::memory_order_relaxed)) {
+            state_.current_speed = 0.0;
+            if (life_observer_) life_observer_->on_destroyed(this);
         }
     }
 }
 
-std::string DefaultShip::get_name() const {
-    return name_;
+void DefaultShip::set_life_observer(IShipLifeObserver* observer) {
+    life_observer_ = observer;
+}
+
+const std::string& DefaultShip::get_name() const {
+    return profile_->name;
 }
-Military DefaultShip::get_captain() const {
-    return captain_;
+const Military& DefaultShip::get_captain() const {
+    return profile_->captain;
 }
-std::string DefaultShip::get_ID() const {
-    return id_;
+const std::string& DefaultShip::get_ID() const {
+    return profile_->id;
 }
 double DefaultShip::get_max_speed() const {
-    return max_speed_;
+    return state_.max_speed;
 }
 double DefaultShip::get_cost() const {
-    return cost_;
+    return profile_->cost;
 }
 
 void DefaultShip::set_name(const std::string& name) {
-    name_ = name;
+    profile_->name = name;
 }
 void DefaultShip::set_captain(const Military& captain) {
-    captain_ = captain;
+    profile_->captain = captain;
 }
 void DefaultShip::set_max_speed(double max_speed) {
     if (max_speed < 0.0) throw std::invalid_argument("Max speed must be positive");
-    max_speed_ = max_speed;
-    if (current_speed_ > max_speed_) current_speed_ = max_speed_;
+    state_.max_speed = max_speed;
+    if (state_.current_speed > state_.max_speed) state_.current_speed = state_.max_speed;
 }
 void DefaultShip::set_cost(double cost) {
-    cost_ = cost;
+    profile_->cost = cost;
 }
 void DefaultShip::set_ID(const std::string& id) {
-    id_ = id;
+    profile_->id = id;
 }
 
 bool DefaultShip::is_convoy() const {
-    return is_convoy_;
+    return state_.is_convoy;
 }
 void DefaultShip::set_convoy(bool is_convoy) {
-    is_convoy_ = is_convoy;
+    state_.is_convoy = is_convoy;
+}
+
+size_t DefaultShip::profile_memory_usage() const {
+    if (!profile_) return 0;
+    return sizeof(ShipProfile) + string_heap_usage(profile_->name) + string_heap_usage(profile_->id) + profile_->captain.heap_usage();
 }
\ No newline at end of file
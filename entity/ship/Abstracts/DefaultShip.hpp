@@ -6,7 +6,40 @@
 #pragma once
 
 #include "../Interfaces/IShip.hpp"
+#include "../Interfaces/IShipLifeObserver.hpp"
+#include "../../../template/ObjectPool.hpp"
 #include <atomic>
+#include <memory>
+
+/**
+ * @struct ShipState
+ * @brief Горячее состояние корабля, которое читается и изменяется на каждом такте симуляции
+ * @details Компактная запись без выравнивания, расположенная в объекте сразу за указателями на таблицы виртуальных функций.
+ * Описательные данные вынесены в ShipProfile, поэтому циклы движения и боя читают только эту запись.
+ */
+struct ShipState {
+    Vector position; ///< Позиция корабля
+    double current_speed = 0.0; ///< Текущая скорость корабля
+    double max_speed = 0.0; ///< Максимальная скорость корабля
+    double max_health = 0.0; ///< Максимальное здоровье корабля
+    std::atomic<double> current_health = 0.0; ///< Атомарное текущее здоровье
+    std::atomic<bool> is_alive = true; ///< Атомарный флаг жизни
+    bool is_convoy = true; ///< Флаг принадлежности к конвою
+};
+
+static_assert(sizeof(ShipState) <= 64, "ShipState must not outgrow a cache line");
+
+/**
+ * @struct ShipProfile
+ * @brief Холодные описательные данные корабля, не нужные в циклах движения и боя
+ * @details Размещаются в отдельном пуле, поэтому при обходе кораблей не загружаются в кэш.
+ */
+struct ShipProfile : public PoolAllocated<ShipProfile> {
+    std::string name; ///< Название корабля
+    Military captain; ///< Капитан корабля
+    std::string id; ///< Идентификатор корабля
+    double cost = 0.0; ///< Стоимость корабля
+};
 
 /**
  * @class DefaultShip
@@ -14,25 +47,20 @@
  */
 class DefaultShip : public IShip {
     protected:
-        std::string name_; ///< Название корабля
-        Military captain_; ///< Капитан корабля
-        double max_speed_; ///< Максимальная скорость корабля
-        double current_speed_; ///< Текущая скорость корабля
-        double cost_; ///< Стоимость корабля
+        ShipState state_; ///< Горячее состояние корабля
+        std::unique_ptr<ShipProfile> profile_; ///< Описательные данные корабля
+        IShipLifeObserver* life_observer_ = nullptr; ///< Наблюдатель гибели и восстановления (репозиторий-владелец)
 
-        std::string id_; ///< Идентификатор корабля
-        bool is_convoy_; ///< Флаг принадлежности к конвою
-        
-        Vector position_; ///< Позиция корабля
-
-        double max_health_; ///< Максимальное здоровье корабля
-        std::atomic<double> current_health_; ///< Атомарное текущее здоровье
-        std::atomic<bool> is_alive_; ///< Атомарный флаг жизни
-        
         /**
          * @brief Проверяет корректность параметров корабля
          */
         void validate_parameters() const;
+
+        /**
+         * @brief Получает объем памяти, занятой описательным профилем вместе со строками
+         * @return size_t Объем памяти в байтах
+         */
+        size_t profile_memory_usage() const;
     public:
         /**
          * @brief Конструктор с параметрами
@@ -74,12 +102,13 @@ class DefaultShip : public IShip {
         void set_health(double health) override;
         void set_max_health(double max_health) override;
         void take_damage(double damage) override;
+        void set_life_observer(IShipLifeObserver* observer) override;
 
-        std::string get_name() const override;
-        Military get_captain() const override;
+        const std::string& get_name() const override;
+        const Military& get_captain() const override;
         double get_max_speed() const override;
         double get_cost() const override;
-        std::string get_ID() const override;
+        const std::string& get_ID() const override;
         
         void set_name(const std::string& name) override;
         void set_captain(const Military& captain) override;
@@ -90,7 +119,7 @@ class DefaultShip : public IShip {
         bool is_convoy() const override;
         void set_convoy(bool is_convoy) override;
 
-        virtual std::string get_type() const override = 0;
+        virtual std::string_view get_type() const override = 0;
         virtual std::string get_description() const override = 0;
         virtual std::unique_ptr<IShip> clone() const override = 0;
         virtual void accept(IShipVisitor* visitor) override = 0;
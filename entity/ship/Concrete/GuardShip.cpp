@@ -12,7 +12,7 @@ GuardShip::GuardShip(
     const Vector& position)
 : DefaultShip(name, captain, max_speed, max_health, cost, id, is_convoy, position) {}
     
-std::string GuardShip::get_type() const {
+std::string_view GuardShip::get_type() const {
     return "guard";
 }
 
@@ -28,7 +28,7 @@ std::string GuardShip::get_description() const {
 }
 
 std::unique_ptr<IShip> GuardShip::clone() const {
-    auto clone = std::make_unique<GuardShip>(name_, captain_, max_speed_, max_health_, cost_, id_, is_convoy_, position_);
+    auto clone = std::make_unique<GuardShip>(profile_->name, profile_->captain, state_.max_speed, state_.max_health, profile_->cost, profile_->id, state_.is_convoy, state_.position);
     for (const auto& [place, weapon] : weapons_) {
         if (weapon) clone->set_weapon_in_place(place, weapon->clone());
     }
@@ -37,4 +37,12 @@ std::unique_ptr<IShip> GuardShip::clone() const {
 
 void GuardShip::accept(IShipVisitor* visitor) {
     visitor->visit(this);
+}
+
+ShipVariant GuardShip::as_variant() {
+    return this;
+}
+
+size_t GuardShip::memory_usage() const {
+    return sizeof(GuardShip) + profile_memory_usage() + weapons_memory_usage();
 }
\ No newline at end of file
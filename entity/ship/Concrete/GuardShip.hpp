@@ -7,12 +7,13 @@
 
 #include "../Abstracts/DefaultShip.hpp"
 #include "../Abstracts/DefaultGuard.hpp"
+#include "../../../template/ObjectPool.hpp"
 
 /**
  * @class GuardShip
  * @brief Класс, представляющий сторожевой корабль
  */
-class GuardShip : public DefaultShip, public DefaultGuard {
+class GuardShip final : public DefaultShip, public DefaultGuard, public PoolAllocated<GuardShip> {
     public:
         /**
          * @brief Конструктор с параметрами по умолчанию
@@ -36,9 +37,11 @@ class GuardShip : public DefaultShip, public DefaultGuard {
             const Vector& position = Vector()
         );
         
-        std::string get_type() const override;
+        std::string_view get_type() const override;
         std::string get_description() const override;
         std::unique_ptr<IShip> clone() const override;
 
         void accept(IShipVisitor* visitor) override;
+        ShipVariant as_variant() override;
+        size_t memory_usage() const override;
 };
\ No newline at end of file
@@ -12,13 +12,13 @@ TransportShip::TransportShip(
     const Vector& position)
 : DefaultShip(name, captain, max_speed, max_health, cost, id, true, position), DefaultCargo(max_cargo, 0.1) {}
 
-std::string TransportShip::get_type() const {
+std::string_view TransportShip::get_type() const {
     return "transport";
 }
 
 double TransportShip::get_speed() const {
     double reduction = current_cargo_ / max_cargo_ * get_speed_reduction_factor();
-    return current_speed_ * (1.0 - reduction);
+    return state_.current_speed * (1.0 - reduction);
 }
 
 std::string TransportShip::get_description() const {
@@ -33,11 +33,19 @@ std::string TransportShip::get_description() const {
 }
 
 std::unique_ptr<IShip> TransportShip::clone() const {
-    auto clone = std::make_unique<TransportShip>(name_, captain_, max_speed_, max_health_, cost_, id_, get_max_cargo(), position_);
+    auto clone = std::make_unique<TransportShip>(profile_->name, profile_->captain, state_.max_speed, state_.max_health, profile_->cost, profile_->id, get_max_cargo(), state_.position);
     clone->set_cargo(get_cargo());
     return clone;
 }
 
 void TransportShip::accept(IShipVisitor* visitor) {
     visitor->visit(this);
+}
+
+ShipVariant TransportShip::as_variant() {
+    return this;
+}
+
+size_t TransportShip::memory_usage() const {
+    return sizeof(TransportShip) + profile_memory_usage();
 }
\ No newline at end of file
@@ -7,12 +7,13 @@
 
 #include "../Abstracts/DefaultShip.hpp"
 #include "../Abstracts/DefaultCargo.hpp"
+#include "../../../template/ObjectPool.hpp"
 
 /**
  * @class TransportShip
  * @brief Класс, представляющий транспортный корабль
  */
-class TransportShip : public DefaultShip, public DefaultCargo {
+class TransportShip final : public DefaultShip, public DefaultCargo, public PoolAllocated<TransportShip> {
     public:
         /**
          * @brief Конструктор с параметрами по умолчанию
@@ -36,11 +37,13 @@ class TransportShip : public DefaultShip, public DefaultCargo {
             const Vector& position = Vector(0.0, 0.0)
         );
 
-        std::string get_type() const override;
+        std::string_view get_type() const override;
         std::string get_description() const override;
         std::unique_ptr<IShip> clone() const override;
         
         double get_speed() const override;
 
         void accept(IShipVisitor* visitor) override;
+        ShipVariant as_variant() override;
+        size_t memory_usage() const override;
 };
\ No newline at end of file
@@ -12,13 +12,13 @@ WarShip::WarShip(
     const Vector& position)
 : DefaultShip(name, captain, max_speed, max_health, cost, id, true, position), DefaultCargo(max_cargo, 0.15) {}
 
-std::string WarShip::get_type() const {
+std::string_view WarShip::get_type() const {
     return "war";
 }
 
 double WarShip::get_speed() const {
     double reduction = current_cargo_ / max_cargo_ * get_speed_reduction_factor();
-    return current_speed_ * (1.0 - reduction);
+    return state_.current_speed * (1.0 - reduction);
 }
 
 std::string WarShip::get_description() const {
@@ -34,7 +34,7 @@ std::string WarShip::get_description() const {
 }
 
 std::unique_ptr<IShip> WarShip::clone() const {
-    auto clone = std::make_unique<WarShip>(name_, captain_, max_speed_, max_health_, cost_, id_, get_max_cargo(), position_);
+    auto clone = std::make_unique<WarShip>(profile_->name, profile_->captain, state_.max_speed, state_.max_health, profile_->cost, profile_->id, get_max_cargo(), state_.position);
     clone->set_cargo(get_cargo());
     for (const auto& [place, weapon] : weapons_) {
         if (weapon) clone->set_weapon_in_place(place, weapon->clone());
@@ -44,4 +44,12 @@ std::unique_ptr<IShip> WarShip::clone() const {
 
 void WarShip::accept(IShipVisitor* visitor) {
     visitor->visit(this);
+}
+
+ShipVariant WarShip::as_variant() {
+    return this;
+}
+
+size_t WarShip::memory_usage() const {
+    return sizeof(WarShip) + profile_memory_usage() + weapons_memory_usage();
 }
\ No newline at end of file
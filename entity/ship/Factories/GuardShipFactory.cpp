@@ -19,6 +19,10 @@ std::unique_ptr<IShip> GuardShipFactory::create_ship(
     return std::make_unique<GuardShip>(name, captain, max_speed, max_health, cost, "", is_convoy, position);
 }
 
+void GuardShipFactory::reserve(size_t count) const {
+    ObjectPool<GuardShip>::instance().reserve(count);
+}
+
 void GuardShipFactory::set_prototype(std::unique_ptr<GuardShip> prototype) {
     prototype_ = std::move(prototype);
 }
\ No newline at end of file
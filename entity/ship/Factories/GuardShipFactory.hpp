@@ -37,6 +37,7 @@ class GuardShipFactory : public IShipFactory {
             std::optional<double> max_cargo = std::nullopt,
             const Vector& position = Vector(0, 0)
         ) const override;
+        void reserve(size_t count) const override;
         
         /**
          * @brief Устанавливает прототип для фабрики
@@ -47,4 +47,10 @@ class IShipFactory {
             std::optional<double> max_cargo = std::nullopt,
             const Vector& position = Vector(0, 0)
         ) const = 0;
+
+        /**
+         * @brief Резервирует в пуле памяти место под заданное количество кораблей
+         * @param count Количество кораблей
+         */
+        virtual void reserve(size_t count) const = 0;
 };
\ No newline at end of file
@@ -72,6 +72,18 @@ bool ShipFactoryManager::has_factory(const std::string& type) const {
     return factories_.find(type) != factories_.end();
 }
 
+void ShipFactoryManager::reserve(const std::string& type, size_t count) const {
+    auto factory = get_factory(type);
+    if (factory) factory->reserve(count);
+}
+
+void ShipFactoryManager::release_pools() {
+    ObjectPool<GuardShip>::instance().release();
+    ObjectPool<WarShip>::instance().release();
+    ObjectPool<TransportShip>::instance().release();
+    ObjectPool<ShipProfile>::instance().release();
+}
+
 void ShipFactoryManager::set_default_max_cargo(const std::string& type, double max_cargo) {
     auto factory = get_factory(type);
     if (factory) {
@@ -102,6 +102,19 @@ class ShipFactoryManager {
          */
         bool has_factory(const std::string& type) const;
 
+        /**
+         * @brief Резервирует в пуле памяти место под корабли заданного типа
+         * @param type Тип корабля
+         * @param count Количество кораблей
+         */
+        void reserve(const std::string& type, size_t count) const;
+
+        /**
+         * @brief Освобождает блоки пулов памяти кораблей всех типов, в которых не осталось живых объектов
+         * @details Вызывается после уничтожения миссии вместе со всеми кораблями, включая прототипы фабрик
+         */
+        static void release_pools();
+
         /**
          * @brief Устанавливает значение максимальной грузоподъемности по умолчанию для указанного типа корабля
          * @param type Тип корабля
@@ -20,6 +20,10 @@ std::unique_ptr<IShip> TransportShipFactory::create_ship(
     return std::make_unique<TransportShip>(name, captain, max_speed, max_health, cost, "", cargo_to_use, position);
 }
 
+void TransportShipFactory::reserve(size_t count) const {
+    ObjectPool<TransportShip>::instance().reserve(count);
+}
+
 void TransportShipFactory::set_prototype(std::unique_ptr<TransportShip> prototype) {
     prototype_ = std::move(prototype);
 }
@@ -38,6 +38,7 @@ class TransportShipFactory : public IShipFactory {
             std::optional<double> max_cargo = std::nullopt,
             const Vector& position = Vector(0, 0)
         ) const override;
+        void reserve(size_t count) const override;
         
         /**
          * @brief Устанавливает прототип для фабрики
@@ -20,6 +20,10 @@ std::unique_ptr<IShip> WarShipFactory::create_ship(
     return std::make_unique<WarShip>(name, captain, max_speed, max_health, cost, "", cargo_to_use, position);
 }
 
+void WarShipFactory::reserve(size_t count) const {
+    ObjectPool<WarShip>::instance().reserve(count);
+}
+
 void WarShipFactory::set_prototype(std::unique_ptr<WarShip> prototype) {
     prototype_ = std::move(prototype);
 }
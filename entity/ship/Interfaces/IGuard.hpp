@@ -21,10 +21,11 @@ class IGuard {
 
         /**
          * @brief Получает оружие в указанном месте
+         * @details Оружие доступно только для чтения: изменения проходят через методы корабля, которые поддерживают его профиль вооружения
          * @param place Место расположения оружия
-         * @return IWeapon* Указатель на оружие или nullptr если оружия нет
+         * @return const IWeapon* Указатель на оружие или nullptr если оружия нет
          */
-        virtual IWeapon* get_weapon_in_place(PlaceForWeapon place) const = 0;
+        virtual const IWeapon* get_weapon_in_place(PlaceForWeapon place) const = 0;
 
         /**
          * @brief Проверяет наличие оружия в указанном месте
@@ -6,11 +6,13 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <memory>
 #include "../../../auxiliary/Military.hpp"
 #include "IShipPosition.hpp"
 #include "IShipHealth.hpp"
 #include "../../../visitor/IShipVisitor.hpp"
+#include "../../../visitor/ShipVariant.hpp"
 
 /**
  * @class IShip
@@ -25,21 +27,21 @@ class IShip : public IShipPosition, public IShipHealth {
 
         /**
          * @brief Получает тип корабля
-         * @return std::string Тип корабля
+         * @return std::string_view Тип корабля (строковый литерал, действителен все время работы программы)
          */
-        virtual std::string get_type() const = 0;
+        virtual std::string_view get_type() const = 0;
         
         /**
          * @brief Получает название корабля
-         * @return std::string Название корабля
+         * @return const std::string& Ссылка на название корабля
          */
-        virtual std::string get_name() const = 0;
+        virtual const std::string& get_name() const = 0;
         
         /**
          * @brief Получает капитана корабля
-         * @return Military Капитан корабля
+         * @return const Military& Ссылка на капитана корабля
          */
-        virtual Military get_captain() const = 0;
+        virtual const Military& get_captain() const = 0;
         
         /**
          * @brief Получает максимальную скорость корабля
@@ -55,9 +57,9 @@ class IShip : public IShipPosition, public IShipHealth {
         
         /**
          * @brief Получает идентификатор корабля
-         * @return std::string Идентификатор корабля
+         * @return const std::string& Ссылка на идентификатор корабля
          */
-        virtual std::string get_ID() const = 0;
+        virtual const std::string& get_ID() const = 0;
 
         /**
          * @brief Устанавливает название корабля
@@ -118,4 +120,17 @@ class IShip : public IShipPosition, public IShipHealth {
          * @param visitor Посетитель корабля
          */
         virtual void accept(IShipVisitor* visitor) = 0;
+
+        /**
+         * @brief Получает указатель на корабль с конкретным типом для обработки через std::visit
+         * @return ShipVariant Указатель на этот корабль
+         */
+        virtual ShipVariant as_variant() = 0;
+
+        /**
+         * @brief Получает объем памяти, занятой кораблем
+         * @details Учитывает сам объект, описательный профиль, строки в куче и установленное оружие
+         * @return size_t Объем памяти в байтах
+         */
+        virtual size_t memory_usage() const = 0;
 };
\ No newline at end of file
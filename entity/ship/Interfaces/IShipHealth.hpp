@@ -5,6 +5,8 @@
 
 #pragma once
 
+class IShipLifeObserver;
+
 /**
  * @class IShipHealth
  * @brief Интерфейс, представляющий здоровье корабля
@@ -51,4 +53,10 @@ class IShipHealth {
          * @param damage Величина урона
          */
         virtual void take_damage(double damage) = 0;
+
+        /**
+         * @brief Устанавливает наблюдателя, которому корабль сообщает о гибели и восстановлении
+         * @param observer Указатель на наблюдателя (nullptr отключает уведомления)
+         */
+        virtual void set_life_observer(IShipLifeObserver* observer) = 0;
 };
\ No newline at end of file
@@ -0,0 +1,33 @@
+/**
+ * @file IShipLifeObserver.hpp
+ * @brief Заголовочный файл, содержащий определение интерфейса IShipLifeObserver
+ */
+
+#pragma once
+
+class IShip;
+
+/**
+ * @class IShipLifeObserver
+ * @brief Интерфейс наблюдателя, которому корабль сообщает о гибели и восстановлении
+ * @details Уведомление приходит из потока, изменившего здоровье, ровно один раз на каждый переход состояния.
+ */
+class IShipLifeObserver {
+    public:
+        /**
+         * @brief Виртуальный деструктор
+         */
+        virtual ~IShipLifeObserver() = default;
+
+        /**
+         * @brief Вызывается, когда корабль потоплен
+         * @param ship Указатель на корабль
+         */
+        virtual void on_destroyed(IShip* ship) = 0;
+
+        /**
+         * @brief Вызывается, когда здоровье потопленного корабля восстановлено
+         * @param ship Указатель на корабль
+         */
+        virtual void on_revived(IShip* ship) = 0;
+};
@@ -1,4 +1,5 @@
 #include "DefaultWeapon.hpp"
+#include "../../../auxiliary/HeapUsage.hpp"
 
 #include <random>
 #include <sstream>
@@ -35,7 +36,7 @@ DefaultWeapon::DefaultWeapon(
     validate_parameters();
 }
 
-std::string DefaultWeapon::get_type() const {
+const std::string& DefaultWeapon::get_type() const {
     return type;
 }
 std::string DefaultWeapon::get_name() const {
@@ -91,4 +92,8 @@ std::string DefaultWeapon::get_description() const {
         << ", Точность: " << std::setprecision(0) << (accuracy * 100) << "%"
         << std::setprecision(1) << ", Стоимость: " << cost << "]";
     return oss.str();
+}
+
+size_t DefaultWeapon::strings_heap_usage() const {
+    return string_heap_usage(type) + string_heap_usage(name);
 }
\ No newline at end of file
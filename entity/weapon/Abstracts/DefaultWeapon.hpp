@@ -28,6 +28,12 @@ class DefaultWeapon : public IWeapon {
          * @brief Проверяет корректность параметров оружия
          */
         void validate_parameters() const;
+
+        /**
+         * @brief Получает объем памяти в куче, занятой строками оружия
+         * @return size_t Объем памяти в байтах
+         */
+        size_t strings_heap_usage() const;
     public:
         /**
          * @brief Конструктор с параметрами
@@ -58,7 +64,7 @@ class DefaultWeapon : public IWeapon {
          */
         ~DefaultWeapon() override = default;
 
-        std::string get_type() const override;
+        const std::string& get_type() const override;
         std::string get_name() const override;
         double get_damage() const override;
         double get_range() const override;
@@ -13,4 +13,8 @@ Gun::Gun(
 
 std::unique_ptr<IWeapon> Gun::clone() const {
     return std::make_unique<Gun>(*this);
+}
+
+size_t Gun::memory_usage() const {
+    return sizeof(Gun) + strings_heap_usage();
 }
\ No newline at end of file
@@ -6,12 +6,13 @@
 #pragma once
 
 #include "../Abstracts/DefaultWeapon.hpp"
+#include "../../../template/ObjectPool.hpp"
 
 /**
  * @class Gun
  * @brief Класс, представляющий пушечное оружие
  */
-class Gun : public DefaultWeapon {
+class Gun : public DefaultWeapon, public PoolAllocated<Gun> {
     public:
         /**
          * @brief Конструктор с параметрами по умолчанию
@@ -36,4 +37,5 @@ class Gun : public DefaultWeapon {
         );
 
         std::unique_ptr<IWeapon> clone() const override;
+        size_t memory_usage() const override;
 };
\ No newline at end of file
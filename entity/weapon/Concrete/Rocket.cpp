@@ -13,4 +13,8 @@ Rocket::Rocket(
 
 std::unique_ptr<IWeapon> Rocket::clone() const {
     return std::make_unique<Rocket>(*this);
+}
+
+size_t Rocket::memory_usage() const {
+    return sizeof(Rocket) + strings_heap_usage();
 }
\ No newline at end of file
@@ -6,12 +6,13 @@
 #pragma once
 
 #include "../Abstracts/DefaultWeapon.hpp"
+#include "../../../template/ObjectPool.hpp"
 
 /**
  * @class Rocket
  * @brief Класс, представляющий ракетное оружие
  */
-class Rocket : public DefaultWeapon {
+class Rocket : public DefaultWeapon, public PoolAllocated<Rocket> {
     public:
         /**
          * @brief Конструктор с параметрами по умолчанию
@@ -36,4 +37,5 @@ class Rocket : public DefaultWeapon {
         );
 
         std::unique_ptr<IWeapon> clone() const override;
+        size_t memory_usage() const override;
 };
\ No newline at end of file
@@ -19,6 +19,10 @@ std::unique_ptr<IWeapon> GunFactory::create_weapon(
     return std::make_unique<Gun>(name, damage, range, fire_rate, max_ammo, cost, accuracy, explosion_radius);
 }
 
+void GunFactory::reserve(size_t count) const {
+    ObjectPool<Gun>::instance().reserve(count);
+}
+
 void GunFactory::set_prototype(std::unique_ptr<Gun> prototype) {
     prototype_ = std::move(prototype);
 }
\ No newline at end of file
@@ -37,6 +37,7 @@ class GunFactory : public IWeaponFactory {
             double accuracy,
             double explosion_radius = 0.0
         ) const override;
+        void reserve(size_t count) const override;
 
         /**
          * @brief Устанавливает прототип для фабрики
@@ -47,4 +47,10 @@ class IWeaponFactory {
             double accuracy,
             double explosion_radius
         ) const = 0;
+
+        /**
+         * @brief Резервирует в пуле памяти место под заданное количество оружия
+         * @param count Количество оружия
+         */
+        virtual void reserve(size_t count) const = 0;
 };
\ No newline at end of file
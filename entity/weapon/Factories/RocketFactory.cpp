@@ -19,6 +19,10 @@ std::unique_ptr<IWeapon> RocketFactory::create_weapon(
     return std::make_unique<Rocket>(name, damage, range, fire_rate, max_ammo, cost, accuracy, explosion_radius);
 }
 
+void RocketFactory::reserve(size_t count) const {
+    ObjectPool<Rocket>::instance().reserve(count);
+}
+
 void RocketFactory::set_prototype(std::unique_ptr<Rocket> prototype) {
     prototype_ = std::move(prototype);
 }
\ No newline at end of file
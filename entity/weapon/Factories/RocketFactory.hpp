@@ -37,6 +37,7 @@ class RocketFactory : public IWeaponFactory {
             double accuracy,
             double explosion_radius
         ) const override;
+        void reserve(size_t count) const override;
 
         /**
          * @brief Устанавливает прототип для фабрики
@@ -49,4 +49,14 @@ IWeaponFactory* WeaponFactoryManager::get_factory(const std::string& type) const
 
 bool WeaponFactoryManager::has_factory(const std::string& type) const {
     return factories_.find(type) != factories_.end();
+}
+
+void WeaponFactoryManager::reserve(const std::string& type, size_t count) const {
+    auto factory = get_factory(type);
+    if (factory) factory->reserve(count);
+}
+
+void WeaponFactoryManager::release_pools() {
+    ObjectPool<Gun>::instance().release();
+    ObjectPool<Rocket>::instance().release();
 }
\ No newline at end of file
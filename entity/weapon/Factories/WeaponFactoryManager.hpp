@@ -74,4 +74,17 @@ class WeaponFactoryManager {
          * @return bool true если фабрика зарегистрирована, false в противном случае
          */
         bool has_factory(const std::string& type) const;
+
+        /**
+         * @brief Резервирует в пуле памяти место под оружие заданного типа
+         * @param type Тип оружия
+         * @param count Количество оружия
+         */
+        void reserve(const std::string& type, size_t count) const;
+
+        /**
+         * @brief Освобождает блоки пулов памяти оружия всех типов, в которых не осталось живых объектов
+         * @details Вызывается после уничтожения миссии вместе со всем оружием, включая прототипы фабрик
+         */
+        static void release_pools();
 };
\ No newline at end of file
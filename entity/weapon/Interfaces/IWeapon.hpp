@@ -21,9 +21,9 @@ class IWeapon {
 
         /**
          * @brief Получает тип оружия
-         * @return std::string Тип оружия
+         * @return const std::string& Тип оружия
          */
-        virtual std::string get_type() const = 0;
+        virtual const std::string& get_type() const = 0;
         
         /**
          * @brief Получает название оружия
@@ -114,4 +114,11 @@ class IWeapon {
          * @return std::string Описание оружия
          */
         virtual std::string get_description() const = 0;
+
+        /**
+         * @brief Получает объем памяти, занятой оружием
+         * @details Учитывает сам объект и строки в куче
+         * @return size_t Объем памяти в байтах
+         */
+        virtual size_t memory_usage() const = 0;
 };
\ No newline at end of file
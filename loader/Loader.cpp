@@ -32,7 +32,38 @@ std::unique_ptr<Mission> Loader::create_mission_test(size_t convoy_count, size_t
     );
 }
 
+void Loader::teardown() {
+    state_service_.reset();
+    pirate_spawn_service_.reset();
+    cargo_service_.reset();
+    purchase_service_.reset();
+    combat_service_.reset();
+    damage_service_.reset();
+    movement_service_.reset();
+
+    pirate_base_mapper_.reset();
+    pirate_base_dto_mapper_.reset();
+    ship_mapper_manager_.reset();
+    ship_dto_mapper_manager_.reset();
+    mission_mapper_.reset();
+    mission_dto_mapper_.reset();
+
+    pirate_repo_.reset();
+    convoy_repo_.reset();
+    weapon_catalog_.reset();
+    ship_catalog_.reset();
+    mission_.reset();
+
+    ShipFactoryManager::release_pools();
+    WeaponFactoryManager::release_pools();
+}
+
+Loader::~Loader() {
+    teardown();
+}
+
 std::unique_ptr<Presenter> Loader::create_presenter_test(size_t convoy_count, size_t pirate_count) {
+    teardown();
     mission_ = create_mission_test(convoy_count, pirate_count);
     convoy_repo_ = std::make_unique<ShipRepository>();
     pirate_repo_ = std::make_unique<PirateRepository>();
@@ -85,6 +116,7 @@ std::unique_ptr<Presenter> Loader::create_presenter_test(size_t convoy_count, si
 }
 
 std::unique_ptr<Presenter> Loader::create_default_presenter() {
+    teardown();
     mission_ = std::make_unique<Mission>(
         "temp_id", 
         Military(), 
@@ -36,7 +36,17 @@ class Loader {
         std::unique_ptr<PirateBaseMapper> pirate_base_mapper_; ///< Указатель на маппер пиратских баз
 
         std::unique_ptr<Mission> create_mission_test(size_t convoy_count, size_t pirate_count);
+
+        /**
+         * @brief Уничтожает миссию вместе с сервисами, кораблями и каталогами и освобождает блоки пулов памяти кораблей и оружия
+         */
+        void teardown();
     public:
+        /**
+         * @brief Деструктор, уничтожающий миссию
+         */
+        ~Loader();
+
         /**
          * @brief Создает презентер с настройками по умолчанию
          * @return std::unique_ptr<Presenter> Указатель на созданный презентер
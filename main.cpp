@@ -1,11 +1,16 @@
 #include "view/ViewConsole.hpp"
+#include "presenter/InstrumentedPresenter.hpp"
 #include <fstream>
+#include <string_view>
 
 
-int main() {
+int main(int argc, char* argv[]) {
     try {
         Loader loader;
-        auto presenter = loader.create_default_presenter();
+        std::unique_ptr<IPresenter> presenter = loader.create_default_presenter();
+        if (argc > 1 && std::string_view(argv[1]) == "--latency") {
+            presenter = std::make_unique<InstrumentedPresenter>(std::move(presenter), "presenter_latency.txt");
+        }
 
         ViewConsole view(std::move(presenter));
         view.run(0);
@@ -1,4 +1,5 @@
 #include "loader/Loader.hpp"
+#include "auxiliary/Tracer.hpp"
 #include <fstream>
 
 int main() {
@@ -17,16 +18,15 @@ int main() {
                 Loader loader;
                 size_t convoy_count = i, pirate_count = i;
                 auto presenter = loader.create_presenter_test(convoy_count, pirate_count);
-                for (size_t j = 0; j < convoy_count; ++j) {
-                    presenter->purchase_ship("war_light");
-                }
+                presenter->purchase_ships("war_light", convoy_count);
                 presenter->auto_distribute_cargo();
 
-                std::vector<ShipDTO> shoot_ships = presenter->get_attack_ships();
-                for (size_t j = 0; j < shoot_ships.size(); ++j) {
-                    presenter->install_weapon(shoot_ships[j].id, PlaceForWeapon::bow, "rocket_heavy");
-                    presenter->install_weapon(shoot_ships[j].id, PlaceForWeapon::stern, "gun_medium");
-                }
+                FleetSnapshot shoot_ships = presenter->get_attack_snapshot();
+                std::vector<std::string> shoot_ids;
+                shoot_ids.reserve(shoot_ships.size());
+                for (uint32_t id : shoot_ships.id) shoot_ids.emplace_back(shoot_ships.str(id));
+                presenter->install_weapons(shoot_ids, PlaceForWeapon::bow, "rocket_heavy");
+                presenter->install_weapons(shoot_ids, PlaceForWeapon::stern, "gun_medium");
 
                 presenter->set_pirate_strategy("closest");
                 presenter->set_convoy_strategy("closest");
@@ -42,9 +42,7 @@ int main() {
                         presenter->stop_pirates();
 
                         auto start = std::chrono::steady_clock::now();
-                        while (presenter->count_alive_convoy_ships() != 0 && presenter->count_alive_pirate_ships() != 0) {
-                            presenter->auto_combat_sequential();
-                        }
+                        presenter->resolve_combat(false);
                         auto end = std::chrono::steady_clock::now();
                         size_t total = duration_cast<std::chrono::microseconds>(end - start).count();
 
@@ -66,16 +64,15 @@ int main() {
                 Loader loader;
                 size_t convoy_count = i, pirate_count = i;
                 auto presenter = loader.create_presenter_test(convoy_count, pirate_count);
-                for (size_t j = 0; j < convoy_count; ++j) {
-                    presenter->purchase_ship("war_light");
-                }
+                presenter->purchase_ships("war_light", convoy_count);
                 presenter->auto_distribute_cargo();
 
-                std::vector<ShipDTO> shoot_ships = presenter->get_attack_ships();
-                for (size_t j = 0; j < shoot_ships.size(); ++j) {
-                    presenter->install_weapon(shoot_ships[j].id, PlaceForWeapon::bow, "rocket_heavy");
-                    presenter->install_weapon(shoot_ships[j].id, PlaceForWeapon::stern, "gun_medium");
-                }
+                FleetSnapshot shoot_ships = presenter->get_attack_snapshot();
+                std::vector<std::string> shoot_ids;
+                shoot_ids.reserve(shoot_ships.size());
+                for (uint32_t id : shoot_ships.id) shoot_ids.emplace_back(shoot_ships.str(id));
+                presenter->install_weapons(shoot_ids, PlaceForWeapon::bow, "rocket_heavy");
+                presenter->install_weapons(shoot_ids, PlaceForWeapon::stern, "gun_medium");
 
                 presenter->set_pirate_strategy("closest");
                 presenter->set_convoy_strategy("closest");
@@ -91,9 +88,7 @@ int main() {
                         presenter->stop_pirates();
                         
                         auto start = std::chrono::steady_clock::now();
-                        while (presenter->count_alive_convoy_ships() != 0 && presenter->count_alive_pirate_ships() != 0) {
-                            presenter->auto_combat_parallel();
-                        }
+                        presenter->resolve_combat(true);
                         auto end = std::chrono::steady_clock::now();
                         size_t total = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
 
@@ -111,6 +106,9 @@ int main() {
             file << std::endl;
         }
         file.close();
+#ifdef PIRATE_TRACING
+        if (!Tracer::instance().save_chrome_trace("trace.json")) std::cerr << "Не удалось сохранить трассу!" << std::endl;
+#endif
     }
     catch (const std::exception& e) {
         std::cerr << "Ошибка: " << e.what() << std::endl;
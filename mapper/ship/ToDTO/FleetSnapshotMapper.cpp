@@ -0,0 +1,111 @@
+#include "FleetSnapshotMapper.hpp"
+#include "../../../entity/ship/Interfaces/ICargo.hpp"
+#include "../../../entity/ship/Interfaces/IGuard.hpp"
+
+uint32_t FleetSnapshotMapper::intern(FleetSnapshot& snapshot, StringIndex& index, std::string_view value) {
+    auto it = index.find(value);
+    if (it != index.end()) return *it;
+    uint32_t ref = static_cast<uint32_t>(snapshot.strings.size());
+    snapshot.strings.emplace_back(value);
+    index.insert(ref);
+    return ref;
+}
+
+FleetSnapshot FleetSnapshotMapper::transform(const std::vector<IShip*>& ships) const {
+    FleetSnapshot snapshot;
+    size_t count = ships.size();
+    for (auto* column : {&snapshot.type, &snapshot.id, &snapshot.name, &snapshot.captain_fio, &snapshot.captain_rank}) column->reserve(count);
+    for (auto* column : {&snapshot.max_speed, &snapshot.current_speed, &snapshot.cost, &snapshot.position_x, &snapshot.position_y,
+        &snapshot.max_health, &snapshot.current_health, &snapshot.max_cargo, &snapshot.current_cargo, &snapshot.speed_reduction_factor}) column->reserve(count);
+    snapshot.is_alive.reserve(count);
+    snapshot.is_convoy.reserve(count);
+    snapshot.weapon_begin.reserve(count + 1);
+    snapshot.strings.reserve(count + 16);
+
+    StringIndex index(count + 16, PoolHash{&snapshot.strings}, PoolEqual{&snapshot.strings});
+    for (const IShip* ship : ships) {
+        if (!ship) continue;
+        snapshot.type.push_back(intern(snapshot, index, ship->get_type()));
+        snapshot.id.push_back(intern(snapshot, index, ship->get_ID()));
+        snapshot.name.push_back(intern(snapshot, index, ship->get_name()));
+        const Military& captain = ship->get_captain();
+        snapshot.captain_fio.push_back(intern(snapshot, index, captain.FIO));
+        snapshot.captain_rank.push_back(intern(snapshot, index, captain.rank));
+
+        snapshot.max_speed.push_back(ship->get_max_speed());
+        snapshot.current_speed.push_back(ship->get_speed());
+        snapshot.cost.push_back(ship->get_cost());
+        Vector position = ship->get_position();
+        snapshot.position_x.push_back(position.x);
+        snapshot.position_y.push_back(position.y);
+        snapshot.max_health.push_back(ship->get_max_health());
+        snapshot.current_health.push_back(ship->get_health());
+        snapshot.is_alive.push_back(ship->is_alive());
+        snapshot.is_convoy.push_back(ship->is_convoy());
+
+        const ICargo* cargo = dynamic_cast<const ICargo*>(ship);
+        snapshot.max_cargo.push_back(cargo ? cargo->get_max_cargo() : 0.0);
+        snapshot.current_cargo.push_back(cargo ? cargo->get_cargo() : 0.0);
+        snapshot.speed_reduction_factor.push_back(cargo ? cargo->get_speed_reduction_factor() : 0.0);
+
+        snapshot.weapon_begin.push_back(static_cast<uint32_t>(snapshot.weapons.size()));
+        const IGuard* guard = dynamic_cast<const IGuard*>(ship);
+        if (!guard) continue;
+        for (size_t i = 0; i < dense_enum_size<PlaceForWeapon>::value; ++i) {
+            PlaceForWeapon place = static_cast<PlaceForWeapon>(i);
+            const IWeapon* weapon = guard->get_weapon_in_place(place);
+            if (!weapon) continue;
+            snapshot.weapons.push_back(FleetWeaponRow{
+                place,
+                intern(snapshot, index, weapon->get_type()),
+                intern(snapshot, index, weapon->get_name()),
+                weapon->get_damage(),
+                weapon->get_range(),
+                weapon->get_fire_rate(),
+                weapon->get_max_ammo(),
+                weapon->get_current_ammo(),
+                weapon->get_cost(),
+                weapon->get_accuracy(),
+                weapon->get_explosion_radius()
+            });
+        }
+    }
+    snapshot.weapon_begin.push_back(static_cast<uint32_t>(snapshot.weapons.size()));
+    return snapshot;
+}
+
+ShipDTO FleetSnapshotMapper::to_ship_dto(const FleetSnapshot& snapshot, size_t index) const {
+    ShipDTO ship_dto;
+    ship_dto.type = snapshot.str(snapshot.type[index]);
+    ship_dto.id = snapshot.str(snapshot.id[index]);
+    ship_dto.name = snapshot.str(snapshot.name[index]);
+    ship_dto.captain = Military(std::string(snapshot.str(snapshot.captain_fio[index])), std::string(snapshot.str(snapshot.captain_rank[index])));
+    ship_dto.max_speed = snapshot.max_speed[index];
+    ship_dto.current_speed = snapshot.current_speed[index];
+    ship_dto.cost = snapshot.cost[index];
+    ship_dto.position = Vector(snapshot.position_x[index], snapshot.position_y[index]);
+    ship_dto.max_health = snapshot.max_health[index];
+    ship_dto.current_health = snapshot.current_health[index];
+    ship_dto.is_alive = snapshot.is_alive[index];
+    ship_dto.is_convoy = snapshot.is_convoy[index];
+    ship_dto.max_cargo = snapshot.max_cargo[index];
+    ship_dto.current_cargo = snapshot.current_cargo[index];
+    ship_dto.speed_reduction_factor = snapshot.speed_reduction_factor[index];
+
+    for (uint32_t i = snapshot.weapon_begin[index]; i < snapshot.weapon_begin[index + 1]; ++i) {
+        const FleetWeaponRow& row = snapshot.weapons[i];
+        WeaponDTO weapon_dto;
+        weapon_dto.type = snapshot.str(row.type);
+        weapon_dto.name = snapshot.str(row.name);
+        weapon_dto.damage = row.damage;
+        weapon_dto.range = row.range;
+        weapon_dto.fire_rate = row.fire_rate;
+        weapon_dto.max_ammo = row.max_ammo;
+        weapon_dto.current_ammo = row.current_ammo;
+        weapon_dto.cost = row.cost;
+        weapon_dto.accuracy = row.accuracy;
+        weapon_dto.explosion_radius = row.explosion_radius;
+        ship_dto.weapons[row.place] = std::move(weapon_dto);
+    }
+    return ship_dto;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file FleetSnapshotMapper.hpp
+ * @brief Заголовочный файл, содержащий определение класса FleetSnapshotMapper
+ */
+
+#pragma once
+
+#include "../../../entity/ship/Interfaces/IShip.hpp"
+#include "../../../DTO/FleetSnapshot.hpp"
+#include "../../../DTO/ShipDTO.hpp"
+#include "../../../template/StringHash.hpp"
+#include <vector>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+/**
+ * @class FleetSnapshotMapper
+ * @brief Маппер для преобразования группы кораблей в FleetSnapshot
+ */
+class FleetSnapshotMapper {
+    private:
+        /**
+         * @struct PoolHash
+         * @brief Хеш строки пула по ее индексу, допускающий поиск по std::string_view
+         */
+        struct PoolHash {
+            using is_transparent = void; ///< Признак прозрачного сравнения
+            const std::vector<std::string>* strings; ///< Пул строк снимка
+
+            /**
+             * @brief Вычисляет хеш строки пула
+             * @param ref Индекс строки в пуле
+             * @return size_t Хеш строки
+             */
+            size_t operator()(uint32_t ref) const noexcept { return StringHash{}((*strings)[ref]); }
+
+            /**
+             * @brief Вычисляет хеш искомой строки
+             * @param value Строка
+             * @return size_t Хеш строки
+             */
+            size_t operator()(std::string_view value) const noexcept { return StringHash{}(value); }
+        };
+
+        /**
+         * @struct PoolEqual
+         * @brief Сравнение строк пула по их индексам и со строкой std::string_view
+         */
+        struct PoolEqual {
+            using is_transparent = void; ///< Признак прозрачного сравнения
+            const std::vector<std::string>* strings; ///< Пул строк снимка
+
+            /**
+             * @brief Сравнивает две строки пула (строки в пуле не повторяются, поэтому достаточно сравнить индексы)
+             * @param a Индекс первой строки
+             * @param b Индекс второй строки
+             * @return bool true если строки совпадают
+             */
+            bool operator()(uint32_t a, uint32_t b) const noexcept { return a == b; }
+
+            /**
+             * @brief Сравнивает искомую строку со строкой пула
+             * @param value Строка
+             * @param ref Индекс строки в пуле
+             * @return bool true если строки совпадают
+             */
+            bool operator()(std::string_view value, uint32_t ref) const noexcept { return (*strings)[ref] == value; }
+
+            /**
+             * @brief Сравнивает строку пула с искомой строкой
+             * @param ref Индекс строки в пуле
+             * @param value Строка
+             * @return bool true если строки совпадают
+             */
+            bool operator()(uint32_t ref, std::string_view value) const noexcept { return (*strings)[ref] == value; }
+        };
+
+        using StringIndex = std::unordered_set<uint32_t, PoolHash, PoolEqual>; ///< Индекс пула строк (хранит только индексы, строки лежат в пуле)
+
+        /**
+         * @brief Добавляет строку в пул снимка, если ее там еще нет
+         * @param snapshot Снимок
+         * @param index Индекс пула строк
+         * @param value Строка
+         * @return uint32_t Индекс строки в пуле
+         */
+        static uint32_t intern(FleetSnapshot& snapshot, StringIndex& index, std::string_view value);
+    public:
+        /**
+         * @brief Заполняет снимок за один проход по кораблям
+         * @details Все столбцы резервируются заранее, повторяющиеся строки (типы, названия, капитаны, оружие) попадают в пул один раз
+         * @param ships Корабли (nullptr пропускаются)
+         * @return FleetSnapshot Снимок кораблей
+         */
+        FleetSnapshot transform(const std::vector<IShip*>& ships) const;
+
+        /**
+         * @brief Восстанавливает ShipDTO одного корабля из снимка
+         * @param snapshot Снимок
+         * @param index Индекс корабля в снимке
+         * @return ShipDTO Объект DTO корабля
+         */
+        ShipDTO to_ship_dto(const FleetSnapshot& snapshot, size_t index) const;
+};
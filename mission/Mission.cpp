@@ -33,11 +33,11 @@ Mission::Mission(
         if (required_percentage < 0 || required_percentage > 100) throw std::invalid_argument("Required percentage must be between 0 and 100");
 }
 
-std::string Mission::get_id() const {
+const std::string& Mission::get_id() const {
     return id_;
 }
 
-Military Mission::get_commander() const {
+const Military& Mission::get_commander() const {
     return commander_;
 }
 
@@ -46,11 +46,11 @@ double Mission::get_total_budget() const {
 }
 
 double Mission::get_current_budget() const {
-    return current_budget_;
+    return current_budget_.load(std::memory_order_acquire);
 }
 
 double Mission::get_spent_budget() const {
-    return total_budget_ - current_budget_;
+    return total_budget_ - get_current_budget();
 }
 
 bool Mission::can_spend(double amount) const { 
@@ -58,13 +58,18 @@ bool Mission::can_spend(double amount) const {
 }
 
 bool Mission::add_budget(double amount) {
-    current_budget_ += amount;
+    touch();
+    current_budget_.fetch_add(amount, std::memory_order_acq_rel);
     return true;
 }
 
 bool Mission::remove_budget(double amount) {
-    if (!can_spend(amount)) return false;
-    current_budget_ -= amount;
+    if (amount <= 0) return false;
+    double current = current_budget_.load(std::memory_order_relaxed);
+    do {
+        if (current < amount) return false;
+    } while (!current_budget_.compare_exchange_weak(current, current - amount, std::memory_order_acq_rel, std::memory_order_relaxed));
+    touch();
     return true;
 }
 
@@ -73,7 +78,7 @@ double Mission::get_total_cargo() const {
 }
 
 double Mission::get_current_cargo() const {
-    return current_cargo_;
+    return current_cargo_.load(std::memory_order_acquire);
 }
 
 double Mission::get_required_cargo() const { 
@@ -82,7 +87,7 @@ double Mission::get_required_cargo() const {
 
 bool Mission::add_cargo(double amount) {
     if (amount > 0) {
-        current_cargo_ += amount;
+        current_cargo_.fetch_add(amount, std::memory_order_acq_rel);
         return true;
     }
     return false;
@@ -90,8 +95,8 @@ bool Mission::add_cargo(double amount) {
 
 bool Mission::remove_cargo(double amount) {
     if (amount > 0) {
-        if (current_cargo_ >= amount) current_cargo_ -= amount;
-        else current_cargo_ = 0.0;
+        double current = current_cargo_.load(std::memory_order_relaxed);
+        while (!current_cargo_.compare_exchange_weak(current, current >= amount ? current - amount : 0.0, std::memory_order_acq_rel, std::memory_order_relaxed));
         return true;
     }
     return false;
@@ -104,11 +109,11 @@ size_t Mission::get_max_pirate_ships() const {
     return max_pirate_ships_;
 }
 
-Vector Mission::get_base_a() const {
+const Vector& Mission::get_base_a() const {
     return base_a_;
 }
 
-Vector Mission::get_base_b() const {
+const Vector& Mission::get_base_b() const {
     return base_b_;
 }
 
@@ -133,6 +138,7 @@ const PirateBase& Mission::get_pirate_base(size_t index) const {
 }
 
 void Mission::clear_pirate_bases() {
+    touch();
     pirate_bases_.clear();
 }
 
@@ -158,36 +164,65 @@ bool Mission::is_in_progress() const {
 
 double Mission::get_completion_percentage() const {
     if (total_cargo_ <= 0.0) return 0.0;
-    return (current_cargo_ / total_cargo_) * 100.0;
+    return (get_current_cargo() / total_cargo_) * 100.0;
 }
 
 bool Mission::is_goal_achieved() const {
-    return current_cargo_ >= get_required_cargo();
+    return get_current_cargo() >= get_required_cargo();
+}
+
+void Mission::touch() {
+    world_version_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+size_t Mission::get_world_version() const {
+    return world_version_.load(std::memory_order_acquire);
 }
 
 void Mission::set_current_budget(double budget) {
-    current_budget_ = budget;
+    touch();
+    current_budget_.store(budget, std::memory_order_release);
 }
 
 void Mission::set_current_cargo(double cargo) {
-    current_cargo_ = cargo;
+    touch();
+    current_cargo_.store(cargo, std::memory_order_release);
 }
 
 void Mission::set_is_completed(bool is_completed) {
+    touch();
     is_completed_ = is_completed;
 }
 
 void Mission::set_is_successful(bool is_successful) {
+    touch();
     is_successful_ = is_successful;
 }
 
+Mission::Mission(const Mission& other) :
+    id_(other.id_),
+    commander_(other.commander_),
+    total_budget_(other.total_budget_),
+    current_budget_(other.get_current_budget()),
+    total_cargo_(other.total_cargo_),
+    current_cargo_(other.get_current_cargo()),
+    required_cargo_percentage_(other.required_cargo_percentage_),
+    max_convoy_ships_(other.max_convoy_ships_),
+    max_pirate_ships_(other.max_pirate_ships_),
+    base_a_(other.base_a_),
+    base_b_(other.base_b_),
+    base_size_(other.base_size_),
+    pirate_bases_(other.pirate_bases_),
+    is_completed_(other.is_completed_),
+    is_successful_(other.is_successful_) {}
+
 Mission& Mission::operator=(const Mission& other) {
     id_ = other.id_;
     commander_ = other.commander_;
     total_budget_ = other.total_budget_;
-    current_budget_ = other.current_budget_;
+    current_budget_.store(other.get_current_budget(), std::memory_order_release);
     total_cargo_ = other.total_cargo_;
-    current_cargo_ = other.current_cargo_;
+    current_cargo_.store(other.get_current_cargo(), std::memory_order_release);
     required_cargo_percentage_ = other.required_cargo_percentage_;
     max_convoy_ships_ = other.max_convoy_ships_;
     max_pirate_ships_ = other.max_pirate_ships_;
@@ -197,5 +232,6 @@ Mission& Mission::operator=(const Mission& other) {
     pirate_bases_ = other.pirate_bases_;
     is_completed_ = other.is_completed_;
     is_successful_ = other.is_successful_;
+    touch();
     return *this;
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "../auxiliary/Military.hpp"
 #include "../auxiliary/PirateBase.hpp"
 #include <memory>
+#include <atomic>
 
 /**
  * @class Mission
@@ -19,10 +20,10 @@ class Mission {
         Military commander_; ///< Командир миссии
         
         double total_budget_; ///< Общий бюджет миссии
-        double current_budget_; ///< Текущий бюджет миссии
+        std::atomic<double> current_budget_; ///< Текущий бюджет миссии (изменяется атомарно, без блокировок)
         
         double total_cargo_; ///< Общий груз миссии
-        double current_cargo_; ///< Текущий груз миссии
+        std::atomic<double> current_cargo_; ///< Текущий груз миссии (изменяется атомарно, без блокировок)
         double required_cargo_percentage_; ///< Процент необходимого груза
         
         size_t max_convoy_ships_; ///< Максимальное количество кораблей конвоя
@@ -36,6 +37,8 @@ class Mission {
         
         bool is_completed_; ///< Флаг завершения миссии
         bool is_successful_; ///< Флаг успешности миссии
+
+        std::atomic<size_t> world_version_ = 0; ///< Версия состояния мира (увеличивается при каждом изменении)
     public:
         /**
          * @brief Конструктор с параметрами
@@ -67,15 +70,15 @@ class Mission {
         
         /**
          * @brief Получает идентификатор миссии
-         * @return std::string Идентификатор миссии
+         * @return const std::string& Ссылка на идентификатор миссии
          */
-        std::string get_id() const;
+        const std::string& get_id() const;
         
         /**
          * @brief Получает командира миссии
-         * @return Military Командир миссии
+         * @return const Military& Ссылка на командира миссии
          */
-        Military get_commander() const;
+        const Military& get_commander() const;
         
         /**
          * @brief Получает общий бюджет миссии
@@ -97,6 +100,7 @@ class Mission {
         
         /**
          * @brief Проверяет возможность потратить указанную сумму
+         * @details Результат может устареть к моменту списания; атомарное списание выполняет remove_budget
          * @param amount Сумма для проверки
          * @return bool true если сумму можно потратить, false в противном случае
          */
@@ -162,15 +166,15 @@ class Mission {
 
         /**
          * @brief Получает точку A базы
-         * @return Vector Точка A базы
+         * @return const Vector& Ссылка на точку A базы
          */
-        Vector get_base_a() const;
+        const Vector& get_base_a() const;
         
         /**
          * @brief Получает точку B базы
-         * @return Vector Точка B базы
+         * @return const Vector& Ссылка на точку B базы
          */
-        Vector get_base_b() const;
+        const Vector& get_base_b() const;
         
         /**
          * @brief Получает размер базы
@@ -245,6 +249,18 @@ class Mission {
          */
         bool is_goal_achieved() const;
 
+        /**
+         * @brief Отмечает изменение состояния мира
+         * @details Вызывается сервисами после каждой состоявшейся изменяющей операции, чтобы кэши чтения (например, в Presenter) сбрасывались
+         */
+        void touch();
+
+        /**
+         * @brief Получает версию состояния мира
+         * @return size_t Версия состояния мира
+         */
+        size_t get_world_version() const;
+
         /**
          * @brief Устанавливает текущий бюджет
          * @param budget Новое значение текущего бюджета
@@ -269,6 +285,12 @@ class Mission {
          */
         void set_is_successful(bool is_successful);
 
+        /**
+         * @brief Конструктор копирования
+         * @param other другой объект класса
+         */
+        Mission(const Mission& other);
+
         /**
          * @brief Копирующий оператор присваивания
          * @param other другой объект класса
@@ -10,6 +10,9 @@
 #include "../DTO/WeaponDTO.hpp"
 #include "../DTO/MissionDTO.hpp"
 #include "../DTO/PirateBaseDTO.hpp"
+#include "../DTO/FleetSnapshot.hpp"
+#include "../DTO/EngagementDTO.hpp"
+#include "../DTO/CombatRoundDTO.hpp"
 #include "../service/catalog/ship/ShipTemplate.hpp"
 #include "../service/catalog/weapon/WeaponTemplate.hpp"
 
@@ -43,6 +46,14 @@ class IPresenter {
          */
         virtual bool purchase_ship(const std::string &template_id) = 0;
 
+        /**
+         * @brief Покупает несколько кораблей одного шаблона (все или ни одного)
+         * @param template_id Идентификатор шаблона корабля
+         * @param count Количество кораблей
+         * @return bool true если куплены все корабли, false в противном случае
+         */
+        virtual bool purchase_ships(const std::string &template_id, size_t count) = 0;
+
         /**
          * @brief Продает корабль
          * @param template_id Идентификатор шаблона корабля
@@ -79,6 +90,15 @@ class IPresenter {
          */
         virtual bool install_weapon(const std::string &ship_id, PlaceForWeapon place, const std::string &weapon_template_id) = 0;
 
+        /**
+         * @brief Устанавливает оружие одного шаблона на несколько кораблей (на все или ни на один)
+         * @param ship_ids Идентификаторы кораблей
+         * @param place Место установки оружия
+         * @param weapon_template_id Идентификатор шаблона оружия
+         * @return bool true если оружие установлено на все корабли, false в противном случае
+         */
+        virtual bool install_weapons(const std::vector<std::string> &ship_ids, PlaceForWeapon place, const std::string &weapon_template_id) = 0;
+
         /**
          * @brief Проверяет наличие оружия в указанном месте на корабле
          * @param ship_id Идентификатор корабля
@@ -161,27 +181,45 @@ class IPresenter {
 
         /**
          * @brief Получает информацию о миссии
-         * @return MissionDTO Миссия в формате DTO
+         * @return const MissionDTO& Ссылка на миссию в формате DTO (действительна до следующего изменения мира)
          */
-        virtual MissionDTO get_mission() const = 0;
+        virtual const MissionDTO& get_mission() const = 0;
         
         /**
          * @brief Получает корабли конвоя
-         * @return std::vector<ShipDTO> Вектор кораблей конвоя в формате DTO
+         * @return const std::vector<ShipDTO>& Ссылка на вектор кораблей конвоя в формате DTO (действительна до следующего изменения мира)
          */
-        virtual std::vector<ShipDTO> get_convoy_ships() const = 0;
+        virtual const std::vector<ShipDTO>& get_convoy_ships() const = 0;
 
         /**
          * @brief Получает грузовые корабли
-         * @return std::vector<ShipDTO> Вектор грузовых кораблей в формате DTO
+         * @return const std::vector<ShipDTO>& Ссылка на вектор грузовых кораблей в формате DTO (действительна до следующего изменения мира)
          */
-        virtual std::vector<ShipDTO> get_cargo_ships() const = 0;
+        virtual const std::vector<ShipDTO>& get_cargo_ships() const = 0;
 
         /**
          * @brief Получает атакующие корабли
-         * @return std::vector<ShipDTO> Вектор атакующих кораблей в формате DTO
+         * @return const std::vector<ShipDTO>& Ссылка на вектор атакующих кораблей в формате DTO (действительна до следующего изменения мира)
+         */
+        virtual const std::vector<ShipDTO>& get_attack_ships() const = 0;
+
+        /**
+         * @brief Получает колоночный снимок кораблей конвоя
+         * @return FleetSnapshot Снимок кораблей конвоя
+         */
+        virtual FleetSnapshot get_convoy_snapshot() const = 0;
+
+        /**
+         * @brief Получает колоночный снимок грузовых кораблей
+         * @return FleetSnapshot Снимок грузовых кораблей
+         */
+        virtual FleetSnapshot get_cargo_snapshot() const = 0;
+
+        /**
+         * @brief Получает колоночный снимок атакующих кораблей
+         * @return FleetSnapshot Снимок атакующих кораблей
          */
-        virtual std::vector<ShipDTO> get_attack_ships() const = 0;
+        virtual FleetSnapshot get_attack_snapshot() const = 0;
         
         /**
          * @brief Считает количество кораблей в конвое
@@ -197,9 +235,15 @@ class IPresenter {
         
         /**
          * @brief Получает пиратские корабли
-         * @return std::vector<ShipDTO> Вектор пиратских кораблей в формате DTO
+         * @return const std::vector<ShipDTO>& Ссылка на вектор пиратских кораблей в формате DTO (действительна до следующего изменения мира)
          */
-        virtual std::vector<ShipDTO> get_pirate_ships() const = 0;
+        virtual const std::vector<ShipDTO>& get_pirate_ships() const = 0;
+
+        /**
+         * @brief Получает колоночный снимок пиратских кораблей
+         * @return FleetSnapshot Снимок пиратских кораблей
+         */
+        virtual FleetSnapshot get_pirate_snapshot() const = 0;
         
         /**
          * @brief Считает количество живых пиратских кораблей
@@ -216,9 +260,9 @@ class IPresenter {
         
         /**
          * @brief Получает пиратские базы
-         * @return std::vector<PirateBaseDTO> Вектор пиратских баз в формате DTO
+         * @return const std::vector<PirateBaseDTO>& Ссылка на вектор пиратских баз в формате DTO (действительна до следующего изменения мира)
          */
-        virtual std::vector<PirateBaseDTO> get_pirate_bases() const = 0;
+        virtual const std::vector<PirateBaseDTO>& get_pirate_bases() const = 0;
 
         /**
          * @brief Двигает конвой
@@ -262,6 +306,32 @@ class IPresenter {
          */
         virtual void auto_combat_parallel() = 0;
 
+        /**
+         * @brief Проводит бой до уничтожения одной из сторон или до тупика
+         * @param parallel Выполнять ли атаки сторон параллельно
+         * @return EngagementDTO Итоги боя
+         */
+        virtual EngagementDTO resolve_combat(bool parallel) = 0;
+
+        /**
+         * @brief Получает статистику раундов боя
+         * @return std::vector<CombatRoundDTO> Записи раундов
+         */
+        virtual std::vector<CombatRoundDTO> get_combat_rounds() const = 0;
+
+        /**
+         * @brief Получает суммарную статистику раундов боя
+         * @return CombatRoundDTO Сумма по раундам
+         */
+        virtual CombatRoundDTO get_combat_totals() const = 0;
+
+        /**
+         * @brief Сохраняет статистику раундов боя в CSV
+         * @param path Путь к файлу
+         * @return bool true если файл записан, false в противном случае
+         */
+        virtual bool export_combat_csv(const std::string& path) const = 0;
+
         /**
          * @brief Проверяет наличие активированной базы
          * @return int Индекс активированной базы или -1 если нет активированных
@@ -304,6 +374,12 @@ class IPresenter {
          */
         virtual double get_distanse_to_destination() const = 0;
 
+        /**
+         * @brief Получает минимальную стоимость оружия в каталоге
+         * @return double Минимальная стоимость оружия
+         */
+        virtual double get_min_weapon_cost() const = 0;
+
         /**
          * @brief Устанавливает стратегию конвоя
          * @param strategy Название стратегии
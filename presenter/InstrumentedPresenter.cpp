@@ -0,0 +1,301 @@
+#include "InstrumentedPresenter.hpp"
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+InstrumentedPresenter::InstrumentedPresenter(std::unique_ptr<IPresenter> inner, std::string report_path)
+    : inner_(std::move(inner)), report_path_(std::move(report_path)) {
+    if (!inner_) throw std::invalid_argument("Inner presenter cannot be null");
+}
+
+InstrumentedPresenter::~InstrumentedPresenter() {
+    if (!report_path_.empty()) save_report(report_path_);
+}
+
+const LatencyHistogram& InstrumentedPresenter::get_histogram(const std::string& method) const {
+    for (size_t i = 0; i < call_count; ++i) {
+        if (method == call_names[i]) return histograms_[i];
+    }
+    throw std::invalid_argument("Unknown presenter method: " + method);
+}
+
+void InstrumentedPresenter::write_report(std::ostream& out) const {
+    auto microseconds = [](uint64_t nanoseconds) { return static_cast<double>(nanoseconds) / 1000.0; };
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << std::left << std::setw(28) << "method" << std::right << std::setw(10) << "calls"
+        << std::setw(12) << "p50,us" << std::setw(12) << "p90,us" << std::setw(12) << "p99,us"
+        << std::setw(12) << "max,us" << std::setw(12) << "mean,us" << '\n';
+    out << std::fixed << std::setprecision(3);
+    for (size_t i = 0; i < call_count; ++i) {
+        const LatencyHistogram& histogram = histograms_[i];
+        if (histogram.count() == 0) continue;
+        out << std::left << std::setw(28) << call_names[i] << std::right << std::setw(10) << histogram.count()
+            << std::setw(12) << microseconds(histogram.percentile(50.0))
+            << std::setw(12) << microseconds(histogram.percentile(90.0))
+            << std::setw(12) << microseconds(histogram.percentile(99.0))
+            << std::setw(12) << microseconds(histogram.max())
+            << std::setw(12) << histogram.mean() / 1000.0 << '\n';
+    }
+    out.flags(flags);
+    out.precision(precision);
+}
+
+bool InstrumentedPresenter::save_report(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) return false;
+    write_report(file);
+    return static_cast<bool>(file);
+}
+
+void InstrumentedPresenter::clear_histograms() {
+    for (auto& histogram : histograms_) histogram.clear();
+}
+
+const std::vector<ShipTemplate> InstrumentedPresenter::get_available_ships() const {
+    return measure(Call::get_available_ships, [&]() -> decltype(auto) { return inner_->get_available_ships(); });
+}
+
+const std::vector<WeaponTemplate> InstrumentedPresenter::get_available_weapons() const {
+    return measure(Call::get_available_weapons, [&]() -> decltype(auto) { return inner_->get_available_weapons(); });
+}
+
+bool InstrumentedPresenter::purchase_ship(const std::string &template_id) {
+    return measure(Call::purchase_ship, [&]() -> decltype(auto) { return inner_->purchase_ship(template_id); });
+}
+
+bool InstrumentedPresenter::purchase_ships(const std::string &template_id, size_t count) {
+    return measure(Call::purchase_ships, [&]() -> decltype(auto) { return inner_->purchase_ships(template_id, count); });
+}
+
+bool InstrumentedPresenter::sell_ship(const std::string &template_id) {
+    return measure(Call::sell_ship, [&]() -> decltype(auto) { return inner_->sell_ship(template_id); });
+}
+
+bool InstrumentedPresenter::sell_weapon(const std::string &ship_id, PlaceForWeapon place) {
+    return measure(Call::sell_weapon, [&]() -> decltype(auto) { return inner_->sell_weapon(ship_id, place); });
+}
+
+double InstrumentedPresenter::get_current_budget() const {
+    return measure(Call::get_current_budget, [&]() -> decltype(auto) { return inner_->get_current_budget(); });
+}
+
+double InstrumentedPresenter::get_total_budget() const {
+    return measure(Call::get_total_budget, [&]() -> decltype(auto) { return inner_->get_total_budget(); });
+}
+
+bool InstrumentedPresenter::has_weapon_in_place(const std::string &ship_id, PlaceForWeapon place) const {
+    return measure(Call::has_weapon_in_place, [&]() -> decltype(auto) { return inner_->has_weapon_in_place(ship_id, place); });
+}
+
+bool InstrumentedPresenter::can_spend(double amount) const {
+    return measure(Call::can_spend, [&]() -> decltype(auto) { return inner_->can_spend(amount); });
+}
+
+bool InstrumentedPresenter::has_free_place() const {
+    return measure(Call::has_free_place, [&]() -> decltype(auto) { return inner_->has_free_place(); });
+}
+
+bool InstrumentedPresenter::has_occupied_place() const {
+    return measure(Call::has_occupied_place, [&]() -> decltype(auto) { return inner_->has_occupied_place(); });
+}
+
+bool InstrumentedPresenter::install_weapon(const std::string &ship_id, PlaceForWeapon place, const std::string &weapon_template_id) {
+    return measure(Call::install_weapon, [&]() -> decltype(auto) { return inner_->install_weapon(ship_id, place, weapon_template_id); });
+}
+
+bool InstrumentedPresenter::install_weapons(const std::vector<std::string> &ship_ids, PlaceForWeapon place, const std::string &weapon_template_id) {
+    return measure(Call::install_weapons, [&]() -> decltype(auto) { return inner_->install_weapons(ship_ids, place, weapon_template_id); });
+}
+
+double InstrumentedPresenter::get_total_cargo() const {
+    return measure(Call::get_total_cargo, [&]() -> decltype(auto) { return inner_->get_total_cargo(); });
+}
+
+double InstrumentedPresenter::get_current_cargo() const {
+    return measure(Call::get_current_cargo, [&]() -> decltype(auto) { return inner_->get_current_cargo(); });
+}
+
+double InstrumentedPresenter::get_remaining_cargo() const {
+    return measure(Call::get_remaining_cargo, [&]() -> decltype(auto) { return inner_->get_remaining_cargo(); });
+}
+
+double InstrumentedPresenter::get_ship_capacity(const std::string &ship_id) const {
+    return measure(Call::get_ship_capacity, [&]() -> decltype(auto) { return inner_->get_ship_capacity(ship_id); });
+}
+
+double InstrumentedPresenter::get_ship_current_cargo(const std::string &ship_id) const {
+    return measure(Call::get_ship_current_cargo, [&]() -> decltype(auto) { return inner_->get_ship_current_cargo(ship_id); });
+}
+
+bool InstrumentedPresenter::load_cargo(const std::string& ship_id, double amount) {
+    return measure(Call::load_cargo, [&]() -> decltype(auto) { return inner_->load_cargo(ship_id, amount); });
+}
+
+bool InstrumentedPresenter::unload_cargo(const std::string &ship_id, double amount) {
+    return measure(Call::unload_cargo, [&]() -> decltype(auto) { return inner_->unload_cargo(ship_id, amount); });
+}
+
+void InstrumentedPresenter::auto_distribute_cargo() {
+    return measure(Call::auto_distribute_cargo, [&]() -> decltype(auto) { return inner_->auto_distribute_cargo(); });
+}
+
+const MissionDTO& InstrumentedPresenter::get_mission() const {
+    return measure(Call::get_mission, [&]() -> decltype(auto) { return inner_->get_mission(); });
+}
+
+const std::vector<ShipDTO>& InstrumentedPresenter::get_convoy_ships() const {
+    return measure(Call::get_convoy_ships, [&]() -> decltype(auto) { return inner_->get_convoy_ships(); });
+}
+
+const std::vector<ShipDTO>& InstrumentedPresenter::get_cargo_ships() const {
+    return measure(Call::get_cargo_ships, [&]() -> decltype(auto) { return inner_->get_cargo_ships(); });
+}
+
+const std::vector<ShipDTO>& InstrumentedPresenter::get_attack_ships() const {
+    return measure(Call::get_attack_ships, [&]() -> decltype(auto) { return inner_->get_attack_ships(); });
+}
+
+FleetSnapshot InstrumentedPresenter::get_convoy_snapshot() const {
+    return measure(Call::get_convoy_snapshot, [&]() -> decltype(auto) { return inner_->get_convoy_snapshot(); });
+}
+
+FleetSnapshot InstrumentedPresenter::get_cargo_snapshot() const {
+    return measure(Call::get_cargo_snapshot, [&]() -> decltype(auto) { return inner_->get_cargo_snapshot(); });
+}
+
+FleetSnapshot InstrumentedPresenter::get_attack_snapshot() const {
+    return measure(Call::get_attack_snapshot, [&]() -> decltype(auto) { return inner_->get_attack_snapshot(); });
+}
+
+size_t InstrumentedPresenter::count_convoy_ships() const {
+    return measure(Call::count_convoy_ships, [&]() -> decltype(auto) { return inner_->count_convoy_ships(); });
+}
+
+size_t InstrumentedPresenter::count_alive_convoy_ships() const {
+    return measure(Call::count_alive_convoy_ships, [&]() -> decltype(auto) { return inner_->count_alive_convoy_ships(); });
+}
+
+const std::vector<ShipDTO>& InstrumentedPresenter::get_pirate_ships() const {
+    return measure(Call::get_pirate_ships, [&]() -> decltype(auto) { return inner_->get_pirate_ships(); });
+}
+
+FleetSnapshot InstrumentedPresenter::get_pirate_snapshot() const {
+    return measure(Call::get_pirate_snapshot, [&]() -> decltype(auto) { return inner_->get_pirate_snapshot(); });
+}
+
+size_t InstrumentedPresenter::count_alive_pirate_ships() const {
+    return measure(Call::count_alive_pirate_ships, [&]() -> decltype(auto) { return inner_->count_alive_pirate_ships(); });
+}
+
+ShipDTO InstrumentedPresenter::get_ship_by_id(std::string& ship_id) const {
+    return measure(Call::get_ship_by_id, [&]() -> decltype(auto) { return inner_->get_ship_by_id(ship_id); });
+}
+
+const std::vector<PirateBaseDTO>& InstrumentedPresenter::get_pirate_bases() const {
+    return measure(Call::get_pirate_bases, [&]() -> decltype(auto) { return inner_->get_pirate_bases(); });
+}
+
+void InstrumentedPresenter::move_convoy(double dt) {
+    return measure(Call::move_convoy, [&]() -> decltype(auto) { return inner_->move_convoy(dt); });
+}
+
+void InstrumentedPresenter::start_convoy() {
+    return measure(Call::start_convoy, [&]() -> decltype(auto) { return inner_->start_convoy(); });
+}
+
+void InstrumentedPresenter::stop_convoy() {
+    return measure(Call::stop_convoy, [&]() -> decltype(auto) { return inner_->stop_convoy(); });
+}
+
+void InstrumentedPresenter::move_pirates(double dt) {
+    return measure(Call::move_pirates, [&]() -> decltype(auto) { return inner_->move_pirates(dt); });
+}
+
+void InstrumentedPresenter::start_pirates() {
+    return measure(Call::start_pirates, [&]() -> decltype(auto) { return inner_->start_pirates(); });
+}
+
+void InstrumentedPresenter::stop_pirates() {
+    return measure(Call::stop_pirates, [&]() -> decltype(auto) { return inner_->stop_pirates(); });
+}
+
+void InstrumentedPresenter::auto_combat_sequential() {
+    return measure(Call::auto_combat_sequential, [&]() -> decltype(auto) { return inner_->auto_combat_sequential(); });
+}
+
+void InstrumentedPresenter::auto_combat_parallel() {
+    return measure(Call::auto_combat_parallel, [&]() -> decltype(auto) { return inner_->auto_combat_parallel(); });
+}
+
+EngagementDTO InstrumentedPresenter::resolve_combat(bool parallel) {
+    return measure(Call::resolve_combat, [&]() -> decltype(auto) { return inner_->resolve_combat(parallel); });
+}
+
+std::vector<CombatRoundDTO> InstrumentedPresenter::get_combat_rounds() const {
+    return measure(Call::get_combat_rounds, [&]() -> decltype(auto) { return inner_->get_combat_rounds(); });
+}
+
+CombatRoundDTO InstrumentedPresenter::get_combat_totals() const {
+    return measure(Call::get_combat_totals, [&]() -> decltype(auto) { return inner_->get_combat_totals(); });
+}
+
+bool InstrumentedPresenter::export_combat_csv(const std::string& path) const {
+    return measure(Call::export_combat_csv, [&]() -> decltype(auto) { return inner_->export_combat_csv(path); });
+}
+
+int InstrumentedPresenter::has_activated_base() const {
+    return measure(Call::has_activated_base, [&]() -> decltype(auto) { return inner_->has_activated_base(); });
+}
+
+void InstrumentedPresenter::update_base_status(size_t index) {
+    return measure(Call::update_base_status, [&]() -> decltype(auto) { return inner_->update_base_status(index); });
+}
+
+bool InstrumentedPresenter::has_reached_destination() const {
+    return measure(Call::has_reached_destination, [&]() -> decltype(auto) { return inner_->has_reached_destination(); });
+}
+
+bool InstrumentedPresenter::mission_completed() const {
+    return measure(Call::mission_completed, [&]() -> decltype(auto) { return inner_->mission_completed(); });
+}
+
+double InstrumentedPresenter::get_convoy_speed() const {
+    return measure(Call::get_convoy_speed, [&]() -> decltype(auto) { return inner_->get_convoy_speed(); });
+}
+
+Vector InstrumentedPresenter::get_convoy_center() const {
+    return measure(Call::get_convoy_center, [&]() -> decltype(auto) { return inner_->get_convoy_center(); });
+}
+
+double InstrumentedPresenter::get_distanse_to_destination() const {
+    return measure(Call::get_distanse_to_destination, [&]() -> decltype(auto) { return inner_->get_distanse_to_destination(); });
+}
+
+double InstrumentedPresenter::get_min_weapon_cost() const {
+    return measure(Call::get_min_weapon_cost, [&]() -> decltype(auto) { return inner_->get_min_weapon_cost(); });
+}
+
+void InstrumentedPresenter::set_convoy_strategy(const std::string& strategy) {
+    return measure(Call::set_convoy_strategy, [&]() -> decltype(auto) { return inner_->set_convoy_strategy(strategy); });
+}
+
+void InstrumentedPresenter::set_pirate_strategy(const std::string& strategy) {
+    return measure(Call::set_pirate_strategy, [&]() -> decltype(auto) { return inner_->set_pirate_strategy(strategy); });
+}
+
+void InstrumentedPresenter::save_game(const std::string& path) {
+    return measure(Call::save_game, [&]() -> decltype(auto) { return inner_->save_game(path); });
+}
+
+void InstrumentedPresenter::load_game(const std::string& path) {
+    return measure(Call::load_game, [&]() -> decltype(auto) { return inner_->load_game(path); });
+}
+
+std::string InstrumentedPresenter::convoy_info() const {
+    return measure(Call::convoy_info, [&]() -> decltype(auto) { return inner_->convoy_info(); });
+}
+
+std::string InstrumentedPresenter::pirate_info() const {
+    return measure(Call::pirate_info, [&]() -> decltype(auto) { return inner_->pirate_info(); });
+}
\ No newline at end of file
@@ -0,0 +1,316 @@
+/**
+ * @file InstrumentedPresenter.hpp
+ * @brief Заголовочный файл, содержащий определение класса InstrumentedPresenter
+ */
+
+#pragma once
+
+#include "IPresenter.hpp"
+#include "../auxiliary/LatencyHistogram.hpp"
+#include <array>
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string>
+
+/**
+ * @class InstrumentedPresenter
+ * @brief Декоратор презентера, измеряющий задержку каждого вызова IPresenter
+ * @details Каждый метод передает вызов внутреннему презентеру и записывает его длительность в гистограмму метода.
+ * Накладные расходы — два чтения steady_clock и несколько атомарных инкрементов, поэтому декоратор можно оставлять
+ * на реальных сценариях. Отчет с p50/p90/p99/max выгружается по запросу (write_report, save_report)
+ * или автоматически в деструкторе, если задан путь к файлу отчета.
+ */
+class InstrumentedPresenter : public IPresenter {
+    private:
+        /**
+         * @enum Call
+         * @brief Измеряемые методы IPresenter
+         */
+        enum class Call : size_t {
+            get_available_ships,
+            get_available_weapons,
+            purchase_ship,
+            purchase_ships,
+            sell_ship,
+            sell_weapon,
+            get_current_budget,
+            get_total_budget,
+            has_weapon_in_place,
+            can_spend,
+            has_free_place,
+            has_occupied_place,
+            install_weapon,
+            install_weapons,
+            get_total_cargo,
+            get_current_cargo,
+            get_remaining_cargo,
+            get_ship_capacity,
+            get_ship_current_cargo,
+            load_cargo,
+            unload_cargo,
+            auto_distribute_cargo,
+            get_mission,
+            get_convoy_ships,
+            get_cargo_ships,
+            get_attack_ships,
+            get_convoy_snapshot,
+            get_cargo_snapshot,
+            get_attack_snapshot,
+            count_convoy_ships,
+            count_alive_convoy_ships,
+            get_pirate_ships,
+            get_pirate_snapshot,
+            count_alive_pirate_ships,
+            get_ship_by_id,
+            get_pirate_bases,
+            move_convoy,
+            start_convoy,
+            stop_convoy,
+            move_pirates,
+            start_pirates,
+            stop_pirates,
+            auto_combat_sequential,
+            auto_combat_parallel,
+            resolve_combat,
+            get_combat_rounds,
+            get_combat_totals,
+            export_combat_csv,
+            has_activated_base,
+            update_base_status,
+            has_reached_destination,
+            mission_completed,
+            get_convoy_speed,
+            get_convoy_center,
+            get_distanse_to_destination,
+            get_min_weapon_cost,
+            set_convoy_strategy,
+            set_pirate_strategy,
+            save_game,
+            load_game,
+            convoy_info,
+            pirate_info,
+            count
+        };
+
+        static constexpr size_t call_count = static_cast<size_t>(Call::count); ///< Количество измеряемых методов
+
+        /**
+         * @brief Названия методов в порядке перечисления Call
+         */
+        static constexpr std::array<const char*, call_count> call_names = {
+            "get_available_ships",
+            "get_available_weapons",
+            "purchase_ship",
+            "purchase_ships",
+            "sell_ship",
+            "sell_weapon",
+            "get_current_budget",
+            "get_total_budget",
+            "has_weapon_in_place",
+            "can_spend",
+            "has_free_place",
+            "has_occupied_place",
+            "install_weapon",
+            "install_weapons",
+            "get_total_cargo",
+            "get_current_cargo",
+            "get_remaining_cargo",
+            "get_ship_capacity",
+            "get_ship_current_cargo",
+            "load_cargo",
+            "unload_cargo",
+            "auto_distribute_cargo",
+            "get_mission",
+            "get_convoy_ships",
+            "get_cargo_ships",
+            "get_attack_ships",
+            "get_convoy_snapshot",
+            "get_cargo_snapshot",
+            "get_attack_snapshot",
+            "count_convoy_ships",
+            "count_alive_convoy_ships",
+            "get_pirate_ships",
+            "get_pirate_snapshot",
+            "count_alive_pirate_ships",
+            "get_ship_by_id",
+            "get_pirate_bases",
+            "move_convoy",
+            "start_convoy",
+            "stop_convoy",
+            "move_pirates",
+            "start_pirates",
+            "stop_pirates",
+            "auto_combat_sequential",
+            "auto_combat_parallel",
+            "resolve_combat",
+            "get_combat_rounds",
+            "get_combat_totals",
+            "export_combat_csv",
+            "has_activated_base",
+            "update_base_status",
+            "has_reached_destination",
+            "mission_completed",
+            "get_convoy_speed",
+            "get_convoy_center",
+            "get_distanse_to_destination",
+            "get_min_weapon_cost",
+            "set_convoy_strategy",
+            "set_pirate_strategy",
+            "save_game",
+            "load_game",
+            "convoy_info",
+            "pirate_info"
+        };
+
+        /**
+         * @struct ScopedLatency
+         * @brief Замер длительности области видимости с записью в гистограмму
+         */
+        struct ScopedLatency {
+            LatencyHistogram& histogram; ///< Гистограмма метода
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now(); ///< Момент начала вызова
+
+            /**
+             * @brief Деструктор (записывает длительность, в том числе при выходе по исключению)
+             */
+            ~ScopedLatency() {
+                auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+                histogram.record(static_cast<uint64_t>(elapsed.count()));
+            }
+        };
+
+        std::unique_ptr<IPresenter> inner_; ///< Внутренний презентер
+        mutable std::array<LatencyHistogram, call_count> histograms_; ///< Гистограммы задержек по методам
+        std::string report_path_; ///< Путь к файлу отчета, сохраняемого в деструкторе (пустой — не сохранять)
+
+        /**
+         * @brief Выполняет вызов внутреннего презентера с замером длительности
+         * @tparam Function Тип вызова
+         * @param call Измеряемый метод
+         * @param function Вызов
+         * @return decltype(auto) Результат вызова (ссылки передаются без копирования)
+         */
+        template <typename Function>
+        decltype(auto) measure(Call call, Function&& function) const {
+            ScopedLatency latency{histograms_[static_cast<size_t>(call)]};
+            return function();
+        }
+    public:
+        /**
+         * @brief Конструктор
+         * @param inner Внутренний презентер
+         * @param report_path Путь к файлу отчета, сохраняемого в деструкторе (пустой — не сохранять)
+         * @throws std::invalid_argument Если inner равен nullptr
+         */
+        explicit InstrumentedPresenter(std::unique_ptr<IPresenter> inner, std::string report_path = "");
+
+        /**
+         * @brief Деструктор (сохраняет отчет, если задан путь)
+         */
+        ~InstrumentedPresenter() override;
+
+        /**
+         * @brief Получает гистограмму метода
+         * @param method Название метода IPresenter
+         * @return const LatencyHistogram& Ссылка на гистограмму
+         * @throws std::invalid_argument Если метод не найден
+         */
+        const LatencyHistogram& get_histogram(const std::string& method) const;
+
+        /**
+         * @brief Выгружает отчет: по строке на каждый вызывавшийся метод с количеством вызовов, p50/p90/p99/max и средним в микросекундах
+         * @param out Поток вывода
+         */
+        void write_report(std::ostream& out) const;
+
+        /**
+         * @brief Сохраняет отчет в файл
+         * @param path Путь к файлу
+         * @return bool true если файл записан, false в противном случае
+         */
+        bool save_report(const std::string& path) const;
+
+        /**
+         * @brief Обнуляет гистограммы всех методов
+         */
+        void clear_histograms();
+
+
+        const std::vector<ShipTemplate> get_available_ships() const override;
+        const std::vector<WeaponTemplate> get_available_weapons() const override;
+
+        bool purchase_ship(const std::string &template_id) override;
+        bool purchase_ships(const std::string &template_id, size_t count) override;
+        bool sell_ship(const std::string &template_id) override;
+        bool sell_weapon(const std::string &ship_id, PlaceForWeapon place) override;
+        double get_current_budget() const override;
+        double get_total_budget() const override;
+
+        bool has_weapon_in_place(const std::string &ship_id, PlaceForWeapon place) const override;
+        bool can_spend(double amount) const override;
+        bool has_free_place() const override;
+        bool has_occupied_place() const override;
+
+        bool install_weapon(const std::string &ship_id, PlaceForWeapon place, const std::string &weapon_template_id) override;
+        bool install_weapons(const std::vector<std::string> &ship_ids, PlaceForWeapon place, const std::string &weapon_template_id) override;
+
+        double get_total_cargo() const override;
+        double get_current_cargo() const override;
+        double get_remaining_cargo() const override;
+        double get_ship_capacity(const std::string &ship_id) const override;
+        double get_ship_current_cargo(const std::string &ship_id) const override;
+
+        bool load_cargo(const std::string& ship_id, double amount) override;
+        bool unload_cargo(const std::string &ship_id, double amount) override;
+        void auto_distribute_cargo() override;
+
+        const MissionDTO& get_mission() const override;
+        const std::vector<ShipDTO>& get_convoy_ships() const override;
+        const std::vector<ShipDTO>& get_cargo_ships() const override;
+        const std::vector<ShipDTO>& get_attack_ships() const override;
+        FleetSnapshot get_convoy_snapshot() const override;
+        FleetSnapshot get_cargo_snapshot() const override;
+        FleetSnapshot get_attack_snapshot() const override;
+        size_t count_convoy_ships() const override;
+        size_t count_alive_convoy_ships() const override;
+        const std::vector<ShipDTO>& get_pirate_ships() const override;
+        FleetSnapshot get_pirate_snapshot() const override;
+        size_t count_alive_pirate_ships() const override;
+        ShipDTO get_ship_by_id(std::string& ship_id) const override;
+        const std::vector<PirateBaseDTO>& get_pirate_bases() const override;
+
+        void move_convoy(double dt) override;
+        void start_convoy() override;
+        void stop_convoy() override;
+
+        void move_pirates(double dt) override;
+        void start_pirates() override;
+        void stop_pirates() override;
+
+        void auto_combat_sequential() override;
+        void auto_combat_parallel() override;
+        EngagementDTO resolve_combat(bool parallel) override;
+        std::vector<CombatRoundDTO> get_combat_rounds() const override;
+        CombatRoundDTO get_combat_totals() const override;
+        bool export_combat_csv(const std::string& path) const override;
+
+        int has_activated_base() const override;
+        void update_base_status(size_t index) override;
+
+        bool has_reached_destination() const override;
+        bool mission_completed() const override;
+        double get_convoy_speed() const override;
+        Vector get_convoy_center() const override;
+        double get_distanse_to_destination() const override;
+        double get_min_weapon_cost() const override;
+
+        void set_convoy_strategy(const std::string& strategy) override;
+        void set_pirate_strategy(const std::string& strategy) override;
+        
+        void save_game(const std::string& path) override;
+        void load_game(const std::string& path) override;
+
+        std::string convoy_info() const override;
+        std::string pirate_info() const override;
+};
@@ -1,6 +1,7 @@
 #include "Presenter.hpp"
 #include "../visitor/place/PlaceForDamageVisitor.hpp"
 #include "../visitor/cargo/CargoInfoVisitor.hpp"
+#include <fstream>
 
 Presenter::Presenter(
     Mission& mission,
@@ -47,6 +48,13 @@ bool Presenter::purchase_ship(const std::string &template_id) {
     return purchase_service_.buy_ship(template_id, true, position);
 }
 
+bool Presenter::purchase_ships(const std::string &template_id, size_t count) {
+    const auto* template_info = ship_catalog_.find_template_by_id(template_id);
+    if (!template_info || count == 0 || !can_spend(template_info->cost * count)) return false;
+    std::vector<Vector> positions = pirate_spawn_service_.generate_offsets(count);
+    return !purchase_service_.buy_ships(template_id, positions, true).empty();
+}
+
 bool Presenter::sell_ship(const std::string &template_id) {
     const auto* template_info = ship_catalog_.find_template_by_id(template_id);
     for (auto* ship : combat_service_.get_all_ship_ptrs()) {
@@ -71,6 +79,10 @@ bool Presenter::install_weapon(const std::string &ship_id, PlaceForWeapon place,
     return purchase_service_.install_weapon(ship_id, place, std::move(weapon));
 }
 
+bool Presenter::install_weapons(const std::vector<std::string> &ship_ids, PlaceForWeapon place, const std::string &weapon_template_id) {
+    return purchase_service_.install_weapons(ship_ids, place, weapon_template_id);
+}
+
 bool Presenter::has_weapon_in_place(const std::string &ship_id, PlaceForWeapon place) const {
     return purchase_service_.has_weapon_in_place(ship_id, place);
 }
@@ -133,35 +145,58 @@ void Presenter::auto_distribute_cargo() {
     cargo_service_.distribute_evenly(cargo_service_.get_total_cargo() - cargo_service_.get_current_cargo());
 }
 
-MissionDTO Presenter::get_mission() const {
-    return mission_dto_mapper_.transform(&mission_);
+Presenter::FrameCache& Presenter::current_frame() const {
+    size_t version = mission_.get_world_version();
+    if (frame_.version != version) {
+        frame_ = FrameCache{};
+        frame_.version = version;
+    }
+    return frame_;
 }
 
-std::vector<ShipDTO> Presenter::get_convoy_ships() const {
+std::vector<ShipDTO> Presenter::map_ships(const std::vector<IShip*>& ships) const {
     std::vector<ShipDTO> result;
-    auto ships = combat_service_.get_all_ship_ptrs();
+    result.reserve(ships.size());
     for (auto ship : ships) {
         if (ship) result.push_back(ship_dto_mapper_manager_.create_ship_dto(ship));
     }
     return result;
 }
 
-std::vector<ShipDTO> Presenter::get_cargo_ships() const {
-    std::vector<ShipDTO> result;
-    auto ships = cargo_service_.get_cargo_ships();
-    for (auto ship : ships) {
-        if (ship) result.push_back(ship_dto_mapper_manager_.create_ship_dto(ship));
-    }
-    return result;
+const MissionDTO& Presenter::get_mission() const {
+    FrameCache& frame = current_frame();
+    if (!frame.mission) frame.mission = mission_dto_mapper_.transform(&mission_);
+    return *frame.mission;
 }
 
-std::vector<ShipDTO> Presenter::get_attack_ships() const {
-    std::vector<ShipDTO> result;
-    auto ships = combat_service_.get_attack_ships();
-    for (auto ship : ships) {
-        if (ship) result.push_back(ship_dto_mapper_manager_.create_ship_dto(ship));
-    }
-    return result;
+const std::vector<ShipDTO>& Presenter::get_convoy_ships() const {
+    FrameCache& frame = current_frame();
+    if (!frame.convoy_ships) frame.convoy_ships = map_ships(combat_service_.get_all_ship_ptrs());
+    return *frame.convoy_ships;
+}
+
+const std::vector<ShipDTO>& Presenter::get_cargo_ships() const {
+    FrameCache& frame = current_frame();
+    if (!frame.cargo_ships) frame.cargo_ships = map_ships(cargo_service_.get_cargo_ships());
+    return *frame.cargo_ships;
+}
+
+const std::vector<ShipDTO>& Presenter::get_attack_ships() const {
+    FrameCache& frame = current_frame();
+    if (!frame.attack_ships) frame.attack_ships = map_ships(combat_service_.get_attack_ships());
+    return *frame.attack_ships;
+}
+
+FleetSnapshot Presenter::get_convoy_snapshot() const {
+    return fleet_snapshot_mapper_.transform(combat_service_.get_all_ship_ptrs());
+}
+
+FleetSnapshot Presenter::get_cargo_snapshot() const {
+    return fleet_snapshot_mapper_.transform(cargo_service_.get_cargo_ships());
+}
+
+FleetSnapshot Presenter::get_attack_snapshot() const {
+    return fleet_snapshot_mapper_.transform(combat_service_.get_attack_ships());
 }
 
 size_t Presenter::count_convoy_ships() const {
@@ -169,33 +204,43 @@ size_t Presenter::count_convoy_ships() const {
 }
 
 size_t Presenter::count_alive_convoy_ships() const {
-    return combat_service_.get_convoy_alive_count();
+    FrameCache& frame = current_frame();
+    if (!frame.convoy_alive) frame.convoy_alive = combat_service_.get_convoy_alive_count();
+    return *frame.convoy_alive;
 }
 
-std::vector<ShipDTO> Presenter::get_pirate_ships() const {
-    std::vector<ShipDTO> result;
-    auto ships = combat_service_.get_all_pirate_ship_ptrs();
-    for (auto ship : ships) {
-        if (ship) result.push_back(ship_dto_mapper_manager_.create_ship_dto(ship));
-    }
-    return result;
+const std::vector<ShipDTO>& Presenter::get_pirate_ships() const {
+    FrameCache& frame = current_frame();
+    if (!frame.pirate_ships) frame.pirate_ships = map_ships(combat_service_.get_all_pirate_ship_ptrs());
+    return *frame.pirate_ships;
+}
+
+FleetSnapshot Presenter::get_pirate_snapshot() const {
+    return fleet_snapshot_mapper_.transform(combat_service_.get_all_pirate_ship_ptrs());
 }
 
 size_t Presenter::count_alive_pirate_ships() const {
-    return combat_service_.get_pirates_alive_count();
+    FrameCache& frame = current_frame();
+    if (!frame.pirates_alive) frame.pirates_alive = combat_service_.get_pirates_alive_count();
+    return *frame.pirates_alive;
 }
 
 ShipDTO Presenter::get_ship_by_id(std::string& ship_id) const {
     return ship_dto_mapper_manager_.create_ship_dto(combat_service_.get_ship_ptr(ship_id));
 }
 
-std::vector<PirateBaseDTO> Presenter::get_pirate_bases() const {
-    std::vector<PirateBaseDTO> result;
-    auto pirate_bases = pirate_spawn_service_.get_pirate_bases();
-    for (const auto& base : pirate_bases) {
-        result.push_back(pirate_base_dto_mapper_.transform(base));
+const std::vector<PirateBaseDTO>& Presenter::get_pirate_bases() const {
+    FrameCache& frame = current_frame();
+    if (!frame.pirate_bases) {
+        std::vector<PirateBaseDTO> result;
+        const auto& pirate_bases = pirate_spawn_service_.get_pirate_bases();
+        result.reserve(pirate_bases.size());
+        for (const auto& base : pirate_bases) {
+            result.push_back(pirate_base_dto_mapper_.transform(base));
+        }
+        frame.pirate_bases = std::move(result);
     }
-    return result;
+    return *frame.pirate_bases;
 }
 
 void Presenter::move_convoy(double dt) {
@@ -231,18 +276,42 @@ void Presenter::auto_combat_parallel() {
     combat_service_.auto_attack_all_parallel();
 }
 
+EngagementDTO Presenter::resolve_combat(bool parallel) {
+    return combat_service_.resolve_engagement(parallel);
+}
+
+std::vector<CombatRoundDTO> Presenter::get_combat_rounds() const {
+    const auto& rounds = combat_service_.get_combat_rounds();
+    return std::vector<CombatRoundDTO>(rounds.begin(), rounds.end());
+}
+
+CombatRoundDTO Presenter::get_combat_totals() const {
+    return combat_service_.get_combat_totals();
+}
+
+bool Presenter::export_combat_csv(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) return false;
+    combat_service_.write_combat_csv(file);
+    return static_cast<bool>(file);
+}
+
 int Presenter::has_activated_base() const {
-    for (size_t i = 0; i < combat_service_.get_pirate_bases_count(); ++i) {
-        if (combat_service_.is_base_activated(i) && !combat_service_.is_base_defeated(i)) {
-            return i;
+    FrameCache& frame = current_frame();
+    if (!frame.activated_base) {
+        frame.activated_base = -1;
+        for (size_t i = 0; i < combat_service_.get_pirate_bases_count(); ++i) {
+            if (combat_service_.is_base_activated(i) && !combat_service_.is_base_defeated(i)) {
+                frame.activated_base = static_cast<int>(i);
+                break;
+            }
         }
     }
-    return -1;
+    return *frame.activated_base;
 }
 
 void Presenter::update_base_status(size_t index) {
-    auto pirate_bases = pirate_spawn_service_.get_pirate_bases();
-    pirate_spawn_service_.update_base_status(pirate_bases[index]);
+    pirate_spawn_service_.update_base_status(mission_.get_pirate_base(index));
 }
 
 bool Presenter::has_reached_destination() const {
@@ -15,6 +15,8 @@
 #include "../service/purchase/PurchaseService.hpp"
 #include "../service/state/YamlStateService.hpp"
 #include "../template/LookupTable.hpp"
+#include <optional>
+#include <limits>
 
 /**
  * @class Presenter
@@ -37,6 +39,39 @@ class Presenter : public IPresenter {
         MissionDTOMapper& mission_dto_mapper_; ///< Ссылка на маппер миссии DTO
         ShipDTOMapperManager& ship_dto_mapper_manager_; ///< Ссылка на менеджер мапперов кораблей DTO
         PirateBaseDTOMapper& pirate_base_dto_mapper_; ///< Ссылка на маппер пиратских баз DTO
+        FleetSnapshotMapper fleet_snapshot_mapper_; ///< Маппер кораблей в колоночный снимок
+
+        /**
+         * @struct FrameCache
+         * @brief Результаты запросов, вычисленные для одной версии состояния мира
+         */
+        struct FrameCache {
+            size_t version = std::numeric_limits<size_t>::max(); ///< Версия мира, для которой действителен кэш
+            std::optional<MissionDTO> mission; ///< Миссия в формате DTO
+            std::optional<std::vector<ShipDTO>> convoy_ships; ///< Корабли конвоя
+            std::optional<std::vector<ShipDTO>> cargo_ships; ///< Грузовые корабли
+            std::optional<std::vector<ShipDTO>> attack_ships; ///< Атакующие корабли
+            std::optional<std::vector<ShipDTO>> pirate_ships; ///< Пиратские корабли
+            std::optional<std::vector<PirateBaseDTO>> pirate_bases; ///< Пиратские базы
+            std::optional<size_t> convoy_alive; ///< Количество живых кораблей конвоя
+            std::optional<size_t> pirates_alive; ///< Количество живых пиратских кораблей
+            std::optional<int> activated_base; ///< Индекс активной непобежденной базы
+        };
+
+        mutable FrameCache frame_; ///< Кэш запросов текущего кадра (Presenter используется из одного потока)
+
+        /**
+         * @brief Получает кэш текущего кадра, сбрасывая его, если версия мира изменилась
+         * @return FrameCache& Ссылка на кэш
+         */
+        FrameCache& current_frame() const;
+
+        /**
+         * @brief Преобразует корабли в DTO
+         * @param ships Корабли (nullptr пропускаются)
+         * @return std::vector<ShipDTO> Вектор кораблей в формате DTO
+         */
+        std::vector<ShipDTO> map_ships(const std::vector<IShip*>& ships) const;
     public:
         /**
          * @brief Конструктор
@@ -77,6 +112,7 @@ class Presenter : public IPresenter {
         const std::vector<WeaponTemplate> get_available_weapons() const override;
 
         bool purchase_ship(const std::string &template_id) override;
+        bool purchase_ships(const std::string &template_id, size_t count) override;
         bool sell_ship(const std::string &template_id) override;
         bool sell_weapon(const std::string &ship_id, PlaceForWeapon place) override;
         double get_current_budget() const override;
@@ -88,6 +124,7 @@ class Presenter : public IPresenter {
         bool has_occupied_place() const override;
 
         bool install_weapon(const std::string &ship_id, PlaceForWeapon place, const std::string &weapon_template_id) override;
+        bool install_weapons(const std::vector<std::string> &ship_ids, PlaceForWeapon place, const std::string &weapon_template_id) override;
 
         double get_total_cargo() const override;
         double get_current_cargo() const override;
@@ -99,16 +136,20 @@ class Presenter : public IPresenter {
         bool unload_cargo(const std::string &ship_id, double amount) override;
         void auto_distribute_cargo() override;
 
-        MissionDTO get_mission() const override;
-        std::vector<ShipDTO> get_convoy_ships() const override;
-        std::vector<ShipDTO> get_cargo_ships() const override;
-        std::vector<ShipDTO> get_attack_ships() const override;
+        const MissionDTO& get_mission() const override;
+        const std::vector<ShipDTO>& get_convoy_ships() const override;
+        const std::vector<ShipDTO>& get_cargo_ships() const override;
+        const std::vector<ShipDTO>& get_attack_ships() const override;
+        FleetSnapshot get_convoy_snapshot() const override;
+        FleetSnapshot get_cargo_snapshot() const override;
+        FleetSnapshot get_attack_snapshot() const override;
         size_t count_convoy_ships() const override;
         size_t count_alive_convoy_ships() const override;
-        std::vector<ShipDTO> get_pirate_ships() const override;
+        const std::vector<ShipDTO>& get_pirate_ships() const override;
+        FleetSnapshot get_pirate_snapshot() const override;
         size_t count_alive_pirate_ships() const override;
         ShipDTO get_ship_by_id(std::string& ship_id) const override;
-        std::vector<PirateBaseDTO> get_pirate_bases() const override;
+        const std::vector<PirateBaseDTO>& get_pirate_bases() const override;
 
         void move_convoy(double dt) override;
         void start_convoy() override;
@@ -120,6 +161,10 @@ class Presenter : public IPresenter {
 
         void auto_combat_sequential() override;
         void auto_combat_parallel() override;
+        EngagementDTO resolve_combat(bool parallel) override;
+        std::vector<CombatRoundDTO> get_combat_rounds() const override;
+        CombatRoundDTO get_combat_totals() const override;
+        bool export_combat_csv(const std::string& path) const override;
 
         int has_activated_base() const override;
         void update_base_status(size_t index) override;
@@ -129,7 +174,7 @@ class Presenter : public IPresenter {
         double get_convoy_speed() const override;
         Vector get_convoy_center() const override;
         double get_distanse_to_destination() const override;
-        double get_min_weapon_cost() const;
+        double get_min_weapon_cost() const override;
 
         void set_convoy_strategy(const std::string& strategy) override;
         void set_pirate_strategy(const std::string& strategy) override;
@@ -0,0 +1,124 @@
+#include "ActiveShipSet.hpp"
+#include "../auxiliary/HeapUsage.hpp"
+
+void ActiveShipSet::push(IShip* ship, bool archived) {
+    std::vector<IShip*>& ships = archived ? archive_ : active_;
+    slots_[ship] = Slot{archived, ships.size()};
+    ships.push_back(ship);
+}
+
+void ActiveShipSet::swap_remove(const Slot& slot) {
+    std::vector<IShip*>& ships = slot.archived ? archive_ : active_;
+    IShip* last = ships.back();
+    ships[slot.index] = last;
+    slots_[last].index = slot.index;
+    ships.pop_back();
+}
+
+void ActiveShipSet::move(IShip* ship, bool archived) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = slots_.find(ship);
+    if (it == slots_.end() || it->second.archived == archived) return;
+    Slot slot = it->second;
+    swap_remove(slot);
+    push(ship, archived);
+}
+
+ActiveShipSet::~ActiveShipSet() {
+    clear();
+}
+
+void ActiveShipSet::add(IShip* ship) {
+    if (!ship) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (slots_.contains(ship)) return;
+        push(ship, !ship->is_alive());
+    }
+    ship->set_life_observer(this);
+}
+
+void ActiveShipSet::erase(IShip* ship) {
+    if (!ship) return;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = slots_.find(ship);
+    if (it == slots_.end()) return;
+    Slot slot = it->second;
+    swap_remove(slot);
+    slots_.erase(ship);
+    ship->set_life_observer(nullptr);
+}
+
+void ActiveShipSet::replace(IShip* old_ship, IShip* new_ship) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = slots_.find(old_ship);
+        if (it != slots_.end() && new_ship && !slots_.contains(new_ship) && it->second.archived == !new_ship->is_alive()) {
+            Slot slot = it->second;
+            slots_.erase(it);
+            (slot.archived ? archive_ : active_)[slot.index] = new_ship;
+            slots_[new_ship] = slot;
+            old_ship->set_life_observer(nullptr);
+            new_ship->set_life_observer(this);
+            return;
+        }
+    }
+    erase(old_ship);
+    add(new_ship);
+}
+
+void ActiveShipSet::on_destroyed(IShip* ship) {
+    move(ship, true);
+}
+
+void ActiveShipSet::on_revived(IShip* ship) {
+    move(ship, false);
+}
+
+std::vector<IShip*> ActiveShipSet::active() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return active_;
+}
+
+size_t ActiveShipSet::active_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return active_.size();
+}
+
+std::vector<IShip*> ActiveShipSet::archive() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return archive_;
+}
+
+size_t ActiveShipSet::archive_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return archive_.size();
+}
+
+void ActiveShipSet::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (IShip* ship : active_) ship->set_life_observer(nullptr);
+    for (IShip* ship : archive_) ship->set_life_observer(nullptr);
+    active_.clear();
+    archive_.clear();
+    slots_.clear();
+}
+
+void ActiveShipSet::reserve(size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    active_.reserve(capacity);
+    slots_.reserve(capacity);
+}
+
+size_t ActiveShipSet::memory_usage() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t buckets = slots_.bucket_count() > 1 ? slots_.bucket_count() * sizeof(void*) : 0;
+    size_t index_bytes = buckets + slots_.size() * (sizeof(std::pair<const IShip* const, Slot>) + sizeof(void*));
+    return vector_heap_usage(active_) + vector_heap_usage(archive_) + index_bytes;
+}
+
+void ActiveShipSet::shrink_to_fit() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    active_.shrink_to_fit();
+    archive_.shrink_to_fit();
+}
\ No newline at end of file
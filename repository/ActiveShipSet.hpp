@@ -0,0 +1,150 @@
+/**
+ * @file ActiveShipSet.hpp
+ * @brief Заголовочный файл, содержащий определение класса ActiveShipSet
+ */
+
+#pragma once
+
+#include "../entity/ship/Interfaces/IShip.hpp"
+#include "../entity/ship/Interfaces/IShipLifeObserver.hpp"
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+/**
+ * @class ActiveShipSet
+ * @brief Плотный массив живых кораблей репозитория и архив потопленных
+ * @details Набор подписывается на уведомления добавленных кораблей: погибший корабль за O(1) удаляется из массива живых
+ * перестановкой последнего элемента на его место и переносится в архив, восстановленный через set_health() - возвращается в конец массива живых.
+ * Порядок обхода поэтому не совпадает с порядком таблицы репозитория. Чтение не изменяет набор и не обращается к архиву.
+ * Уведомления приходят из потоков боя, поэтому изменения и чтения защищены мьютексом.
+ * Владение кораблями остается у таблицы репозитория.
+ */
+class ActiveShipSet : public IShipLifeObserver {
+    private:
+        /**
+         * @struct Slot
+         * @brief Положение корабля в наборе
+         */
+        struct Slot {
+            bool archived = false; ///< Флаг нахождения в архиве
+            size_t index = 0; ///< Индекс в массиве живых или в архиве
+        };
+
+        std::vector<IShip*> active_; ///< Живые корабли
+        std::vector<IShip*> archive_; ///< Потопленные корабли
+        std::unordered_map<const IShip*, Slot> slots_; ///< Положение каждого корабля набора
+        mutable std::mutex mutex_; ///< Мьютекс массивов и индекса
+
+        /**
+         * @brief Помещает корабль в конец массива живых или архива
+         * @param ship Указатель на корабль
+         * @param archived Флаг помещения в архив
+         */
+        void push(IShip* ship, bool archived);
+
+        /**
+         * @brief Удаляет корабль из его массива перестановкой последнего элемента
+         * @param slot Положение корабля
+         */
+        void swap_remove(const Slot& slot);
+
+        /**
+         * @brief Переносит корабль между массивом живых и архивом
+         * @param ship Указатель на корабль
+         * @param archived Флаг переноса в архив
+         */
+        void move(IShip* ship, bool archived);
+    public:
+        /**
+         * @brief Конструктор по умолчанию
+         */
+        ActiveShipSet() = default;
+
+        /**
+         * @brief Деструктор, отписывающий корабли от уведомлений
+         */
+        ~ActiveShipSet() override;
+
+        ActiveShipSet(const ActiveShipSet&) = delete;
+        ActiveShipSet& operator=(const ActiveShipSet&) = delete;
+
+        /**
+         * @brief Добавляет корабль в массив живых или в архив в зависимости от его состояния и подписывается на его уведомления
+         * @param ship Указатель на корабль
+         */
+        void add(IShip* ship);
+
+        /**
+         * @brief Удаляет корабль из набора и отписывается от его уведомлений
+         * @param ship Указатель на корабль
+         */
+        void erase(IShip* ship);
+
+        /**
+         * @brief Заменяет корабль другим, по возможности на его же месте
+         * @param old_ship Указатель на заменяемый корабль
+         * @param new_ship Указатель на новый корабль
+         */
+        void replace(IShip* old_ship, IShip* new_ship);
+
+        void on_destroyed(IShip* ship) override;
+        void on_revived(IShip* ship) override;
+
+        /**
+         * @brief Вызывает функцию для каждого живого корабля
+         * @tparam Visitor Тип функции
+         * @param visitor Функция, принимающая IShip*
+         */
+        template <typename Visitor>
+        void for_each_active(Visitor&& visitor) const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (IShip* ship : active_) visitor(ship);
+        }
+
+        /**
+         * @brief Получает копию массива живых кораблей
+         * @return std::vector<IShip*> Живые корабли
+         */
+        std::vector<IShip*> active() const;
+
+        /**
+         * @brief Получает количество живых кораблей
+         * @return size_t Количество живых кораблей
+         */
+        size_t active_count() const;
+
+        /**
+         * @brief Получает копию архива потопленных кораблей
+         * @return std::vector<IShip*> Потопленные корабли
+         */
+        std::vector<IShip*> archive() const;
+
+        /**
+         * @brief Получает количество потопленных кораблей
+         * @return size_t Количество потопленных кораблей
+         */
+        size_t archive_count() const;
+
+        /**
+         * @brief Удаляет все корабли и отписывается от их уведомлений
+         */
+        void clear();
+
+        /**
+         * @brief Резервирует место под заданное количество кораблей
+         * @param capacity Требуемая вместимость
+         */
+        void reserve(size_t capacity);
+
+        /**
+         * @brief Получает объем памяти, выделенной под массивы и индекс кораблей
+         * @return size_t Объем памяти в байтах
+         */
+        size_t memory_usage() const;
+
+        /**
+         * @brief Освобождает неиспользуемую вместимость массивов
+         */
+        void shrink_to_fit();
+};
@@ -7,6 +7,7 @@
 
 #include "ICRUD.hpp"
 #include "../entity/ship/Interfaces/IShip.hpp"
+#include "RepositoryMemoryUsage.hpp"
 #include <memory>
 #include <vector>
 
@@ -110,6 +111,18 @@ class IShipRepository : public ICRUD<IShip, std::string> {
          * @return size_t Количество живых кораблей
          */
         virtual size_t count_alive() const = 0;
+
+        /**
+         * @brief Получает потопленные корабли из архива
+         * @return std::vector<IShip*> Вектор указателей на потопленные корабли (порядок не гарантируется)
+         */
+        virtual std::vector<IShip*> get_destroyed_ships() const = 0;
+
+        /**
+         * @brief Считает количество потопленных кораблей
+         * @return size_t Количество потопленных кораблей
+         */
+        virtual size_t count_destroyed() const = 0;
         
         /**
          * @brief Считает количество кораблей заданного типа
@@ -129,4 +142,22 @@ class IShipRepository : public ICRUD<IShip, std::string> {
          * @return double Среднее здоровье кораблей
          */
         virtual double get_average_health() const = 0;
+
+        /**
+         * @brief Резервирует место под заданное количество кораблей
+         * @param capacity Требуемая вместимость репозитория
+         */
+        virtual void reserve(size_t capacity) = 0;
+
+        /**
+         * @brief Получает сведения о памяти, занятой репозиторием
+         * @return RepositoryMemoryUsage Память таблицы, ключей, массивов живых и потопленных кораблей и самих кораблей
+         */
+        virtual RepositoryMemoryUsage memory_usage() const = 0;
+
+        /**
+         * @brief Освобождает неиспользуемую память таблицы и массивов кораблей
+         * @details Указатели на корабли остаются действительными
+         */
+        virtual void shrink_to_fit() = 0;
 };
\ No newline at end of file
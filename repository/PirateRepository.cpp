@@ -1,4 +1,6 @@
 #include "PirateRepository.hpp"
+#include "ShipBatch.hpp"
+#include "../auxiliary/HeapUsage.hpp"
 #include <algorithm>
 #include <limits>
 #include <stdexcept>
@@ -6,12 +8,20 @@
 void PirateRepository::create(std::unique_ptr<IShip> ship) {
     if (!ship) throw std::invalid_argument("Cannot create null ship");
     
-    std::string id = ship->get_ID();
+    const std::string& id = ship->get_ID();
     if (id.empty()) throw std::invalid_argument("Ship must have an ID");
     if (exists(id)) throw std::runtime_error("Pirate ship with ID " + id + " already exists");
     if (ship->is_convoy()) throw std::invalid_argument("Cannot add convoy ship to pirate repository");
     
+    IShip* ptr = ship.get();
     ships_[id] = std::move(ship);
+    fleet_.add(ptr);
+}
+
+void PirateRepository::create_batch(std::vector<std::unique_ptr<IShip>> ships) {
+    create_ship_batch(ships_, fleet_, std::move(ships), [](const IShip& ship) {
+        if (ship.is_convoy()) throw std::invalid_argument("Cannot add convoy ship to pirate repository");
+    }, "Pirate ship");
 }
 
 std::unique_ptr<IShip> PirateRepository::read(const std::string& id) const {
@@ -39,30 +49,31 @@ size_t PirateRepository::count() const {
 void PirateRepository::update(std::unique_ptr<IShip> ship) {
     if (!ship) throw std::invalid_argument("Cannot update null ship");
     
-    std::string id = ship->get_ID();
+    const std::string& id = ship->get_ID();
     if (id.empty()) throw std::invalid_argument("Ship must have an ID");
     if (!exists(id)) throw std::runtime_error("Pirate ship with ID " + id + " not found");
     if (ship->is_convoy()) throw std::invalid_argument("Cannot update with convoy ship");
     
+    fleet_.replace(get_ship_ptr(id), ship.get());
     ships_[id] = std::move(ship);
 }
 
 void PirateRepository::remove(const std::string& id) {
+    fleet_.erase(get_ship_ptr(id));
     ships_.erase(id);
 }
 
 void PirateRepository::clear() {
+    fleet_.clear();
     ships_.clear();
 }
 
 std::vector<IShip*> PirateRepository::get_ships_in_range(const Vector& position, double range) const {
     std::vector<IShip*> result;
-    for (const auto& [id, ship] : ships_) {
-        if (ship && ship->is_alive()) {
-            double distance = ship->get_distance_to(position);
-            if (distance <= range) result.push_back(ship.get());
-        }
-    }
+    fleet_.for_each_active([&](IShip* ship) {
+        double distance = ship->get_distance_to(position);
+        if (distance <= range) result.push_back(ship);
+    });
     return result;
 }
 
@@ -75,18 +86,14 @@ std::vector<IShip*> PirateRepository::get_ships_by_type(const std::string& type)
 }
 
 std::vector<IShip*> PirateRepository::get_alive_ships() const {
-    std::vector<IShip*> result;
-    for (const auto& [id, ship] : ships_) {
-        if (ship && ship->is_alive()) result.push_back(ship.get());
-    }
-    return result;
+    return fleet_.active();
 }
 
 std::vector<IShip*> PirateRepository::get_damaged_ships() const {
     std::vector<IShip*> result;
-    for (const auto& [id, ship] : ships_) {
-        if (ship && ship->is_alive() && ship->get_health() < ship->get_max_health()) result.push_back(ship.get());
-    }
+    fleet_.for_each_active([&](IShip* ship) {
+        if (ship->get_health() < ship->get_max_health()) result.push_back(ship);
+    });
     return result;
 }
 
@@ -110,15 +117,13 @@ IShip* PirateRepository::get_strongest_ship() const {
     IShip* strongest = nullptr;
     double max_health = 0.0;
     
-    for (const auto& [id, ship] : ships_) {
-        if (ship && ship->is_alive()) {
-            double health = ship->get_health();
-            if (health > max_health) {
-                max_health = health;
-                strongest = ship.get();
-            }
+    fleet_.for_each_active([&](IShip* ship) {
+        double health = ship->get_health();
+        if (health > max_health) {
+            max_health = health;
+            strongest = ship;
         }
-    }
+    });
     
     return strongest;
 }
@@ -127,15 +132,13 @@ IShip* PirateRepository::get_weakest_ship() const {
     IShip* weakest = nullptr;
     double min_health = std::numeric_limits<double>::max();
     
-    for (const auto& [id, ship] : ships_) {
-        if (ship && ship->is_alive()) {
-            double health = ship->get_health();
-            if (health < min_health) {
-                min_health = health;
-                weakest = ship.get();
-            }
+    fleet_.for_each_active([&](IShip* ship) {
+        double health = ship->get_health();
+        if (health < min_health) {
+            min_health = health;
+            weakest = ship;
         }
-    }
+    });
     
     return weakest;
 }
@@ -144,15 +147,13 @@ IShip* PirateRepository::get_closest_ship_to(const Vector& position) const {
     IShip* closest = nullptr;
     double min_distance = std::numeric_limits<double>::max();
     
-    for (const auto& [id, ship] : ships_) {
-        if (ship && ship->is_alive()) {
-            double distance = ship->get_distance_to(position);
-            if (distance < min_distance) {
-                min_distance = distance;
-                closest = ship.get();
-            }
+    fleet_.for_each_active([&](IShip* ship) {
+        double distance = ship->get_distance_to(position);
+        if (distance < min_distance) {
+            min_distance = distance;
+            closest = ship;
         }
-    }
+    });
     
     return closest;
 }
@@ -161,15 +162,13 @@ IShip* PirateRepository::get_fastest_ship() const {
     IShip* fastest = nullptr;
     double max_speed = -0.1;
     
-    for (const auto& [id, ship] : ships_) {
-        if (ship && ship->is_alive()) {
-            double speed = ship->get_speed();
-            if (speed > max_speed) {
-                max_speed = speed;
-                fastest = ship.get();
-            }
+    fleet_.for_each_active([&](IShip* ship) {
+        double speed = ship->get_speed();
+        if (speed > max_speed) {
+            max_speed = speed;
+            fastest = ship;
         }
-    }
+    });
     
     return fastest;
 }
@@ -193,11 +192,7 @@ bool PirateRepository::is_ship_alive(const std::string& id) const {
 }
 
 size_t PirateRepository::count_alive() const {
-    size_t count = 0;
-    for (const auto& [id, ship] : ships_) {
-        if (ship && ship->is_alive()) count++;
-    }
-    return count;
+    return fleet_.active_count();
 }
 
 size_t PirateRepository::count_by_type(const std::string& type) const {
@@ -224,6 +219,35 @@ double PirateRepository::get_average_health() const {
     return total / alive_count;
 }
 
+void PirateRepository::reserve(size_t capacity) {
+    ships_.reserve(capacity);
+    fleet_.reserve(capacity);
+}
+
+RepositoryMemoryUsage PirateRepository::memory_usage() const {
+    RepositoryMemoryUsage usage;
+    usage.table = ships_.memory_usage();
+    usage.index_bytes = fleet_.memory_usage();
+    for (const auto& [id, ship] : ships_) {
+        usage.key_bytes += string_heap_usage(id);
+        if (ship) usage.ship_bytes += ship->memory_usage();
+    }
+    return usage;
+}
+
+void PirateRepository::shrink_to_fit() {
+    ships_.shrink_to_fit();
+    fleet_.shrink_to_fit();
+}
+
 bool PirateRepository::validate_pirate_ship(const IShip* ship) const {
     return ship && !ship->is_convoy();
+}
+
+std::vector<IShip*> PirateRepository::get_destroyed_ships() const {
+    return fleet_.archive();
+}
+
+size_t PirateRepository::count_destroyed() const {
+    return fleet_.archive_count();
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include "IShipRepository.hpp"
 #include "../template/LookupTable.hpp"
+#include "ActiveShipSet.hpp"
 
 /**
  * @class PirateRepository
@@ -15,6 +16,7 @@
 class PirateRepository : public IShipRepository {
     private:
         LookupTable<std::string, std::unique_ptr<IShip>> ships_; ///< Таблица пиратских кораблей
+        ActiveShipSet fleet_; ///< Живые корабли и архив потопленных (обновляется уведомлениями кораблей)
     public:
         /**
          * @brief Конструктор по умолчанию
@@ -27,6 +29,15 @@ class PirateRepository : public IShipRepository {
         ~PirateRepository() override = default;
         
         void create(std::unique_ptr<IShip> ship) override;
+
+        /**
+         * @brief Добавляет пачку кораблей (все или ни одного)
+         * @details Резервирует место один раз и проверяет уникальность идентификатора одним проходом по таблице на корабль
+         * @param ships Корабли
+         * @throws std::invalid_argument Если корабль пустой, без идентификатора или принадлежит конвою
+         * @throws std::runtime_error Если корабль с таким идентификатором уже существует
+         */
+        void create_batch(std::vector<std::unique_ptr<IShip>> ships);
         std::unique_ptr<IShip> read(const std::string& id) const override;
         std::vector<std::unique_ptr<IShip>> read_all() const override;
         bool exists(const std::string& id) const override;
@@ -51,9 +62,14 @@ class PirateRepository : public IShipRepository {
         bool is_ship_alive(const std::string& id) const override;
         
         size_t count_alive() const override;
+        std::vector<IShip*> get_destroyed_ships() const override;
+        size_t count_destroyed() const override;
         size_t count_by_type(const std::string& type) const override;
         double get_total_health() const override;
         double get_average_health() const override;
+        void reserve(size_t capacity) override;
+        RepositoryMemoryUsage memory_usage() const override;
+        void shrink_to_fit() override;
         
         /**
          * @brief Проверяет валидность пиратского корабля
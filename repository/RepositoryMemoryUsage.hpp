@@ -0,0 +1,28 @@
+/**
+ * @file RepositoryMemoryUsage.hpp
+ * @brief Заголовочный файл, содержащий определение структуры RepositoryMemoryUsage
+ */
+
+#pragma once
+
+#include "../template/TableMemoryUsage.hpp"
+#include <cstddef>
+
+/**
+ * @struct RepositoryMemoryUsage
+ * @brief Сведения о памяти, занятой репозиторием кораблей
+ */
+struct RepositoryMemoryUsage {
+    TableMemoryUsage table; ///< Хранилище ячеек таблицы кораблей
+    size_t key_bytes = 0; ///< Строки ключей таблицы в куче
+    size_t index_bytes = 0; ///< Массивы живых и потопленных кораблей
+    size_t ship_bytes = 0; ///< Корабли вместе с профилями, строками и установленным оружием
+
+    /**
+     * @brief Получает общий объем памяти репозитория
+     * @return size_t Объем памяти в байтах
+     */
+    size_t total_bytes() const {
+        return table.reserved_bytes() + key_bytes + index_bytes + ship_bytes;
+    }
+};
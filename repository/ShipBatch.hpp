@@ -0,0 +1,53 @@
+/**
+ * @file ShipBatch.hpp
+ * @brief Заголовочный файл, содержащий общую для репозиториев вставку пачки кораблей
+ */
+
+#pragma once
+
+#include "ActiveShipSet.hpp"
+#include "../template/LookupTable.hpp"
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Добавляет пачку кораблей в таблицу репозитория одной операцией
+ * @details Сначала проверяет все корабли, затем резервирует место в таблице и массиве живых и вставляет корабли.
+ * Если идентификатор уже занят, вставленные этой операцией корабли удаляются и репозиторий остается в исходном состоянии.
+ * @tparam Validate Тип проверки корабля, специфичной для репозитория (бросает исключение для недопустимого корабля)
+ * @param table Таблица кораблей репозитория
+ * @param fleet Живые корабли и архив репозитория
+ * @param ships Корабли
+ * @param validate Проверка корабля, вызываемая после общих проверок
+ * @param kind Название кораблей в сообщении о занятом идентификаторе
+ * @throws std::invalid_argument Если корабль пустой или без идентификатора
+ * @throws std::runtime_error Если идентификатор уже занят
+ */
+template <typename Validate>
+void create_ship_batch(LookupTable<std::string, std::unique_ptr<IShip>>& table, ActiveShipSet& fleet, std::vector<std::unique_ptr<IShip>> ships, Validate&& validate, const std::string& kind) {
+    for (const auto& ship : ships) {
+        if (!ship) throw std::invalid_argument("Cannot create null ship");
+        if (ship->get_ID().empty()) throw std::invalid_argument("Ship must have an ID");
+        validate(*ship);
+    }
+
+    table.reserve(table.size() + ships.size());
+    fleet.reserve(fleet.active().size() + ships.size());
+    std::vector<std::pair<std::string, IShip*>> inserted;
+    inserted.reserve(ships.size());
+    for (auto& ship : ships) {
+        std::string id = ship->get_ID();
+        IShip* ptr = ship.get();
+        if (!table.emplace(id, std::move(ship)).second) {
+            for (const auto& [inserted_id, inserted_ptr] : inserted) {
+                fleet.erase(inserted_ptr);
+                table.erase(inserted_id);
+            }
+            throw std::runtime_error(kind + " with ID " + id + " already exists");
+        }
+        fleet.add(ptr);
+        inserted.emplace_back(std::move(id), ptr);
+    }
+}
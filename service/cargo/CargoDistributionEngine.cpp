@@ -0,0 +1,128 @@
+#include "CargoDistributionEngine.hpp"
+#include <algorithm>
+#include <numeric>
+#include <limits>
+
+double CargoSlot::available() const {
+    return std::max(0.0, max_cargo - current_cargo);
+}
+
+double CargoSlot::speed_with(double additional_cargo) const {
+    if (max_cargo <= 0) return max_speed;
+    return max_speed * (1.0 - (current_cargo + additional_cargo) / max_cargo * speed_reduction_factor);
+}
+
+void CargoDistributionEngine::settle(const std::vector<CargoSlot>& slots, std::vector<double>& loads, double total_cargo) {
+    double loaded = std::accumulate(loads.begin(), loads.end(), 0.0);
+    if (loaded > total_cargo && loaded > 0) {
+        double scale = total_cargo / loaded;
+        for (auto& load : loads) load *= scale;
+        return;
+    }
+    double remaining = total_cargo - loaded;
+    for (size_t i = 0; i < slots.size() && remaining > 0; ++i) {
+        double extra = std::min(remaining, slots[i].available() - loads[i]);
+        if (extra <= 0) continue;
+        loads[i] += extra;
+        remaining -= extra;
+    }
+}
+
+std::optional<std::vector<double>> CargoDistributionEngine::distribute_evenly(const std::vector<CargoSlot>& slots, double total_cargo) {
+    std::vector<double> loads(slots.size(), 0.0);
+    if (total_cargo <= 0) return loads;
+
+    std::vector<double> available(slots.size());
+    for (size_t i = 0; i < slots.size(); ++i) available[i] = slots[i].available();
+    if (total_cargo > std::accumulate(available.begin(), available.end(), 0.0) + 1e-9) return std::nullopt;
+
+    std::vector<double> sorted = available;
+    std::sort(sorted.begin(), sorted.end());
+
+    double level = sorted.empty() ? 0.0 : sorted.back();
+    double filled = 0.0;
+    for (size_t k = 0; k < sorted.size(); ++k) {
+        size_t rest = sorted.size() - k;
+        if (filled + sorted[k] * rest >= total_cargo) {
+            level = (total_cargo - filled) / rest;
+            break;
+        }
+        filled += sorted[k];
+    }
+
+    for (size_t i = 0; i < slots.size(); ++i) loads[i] = std::min(available[i], level);
+    settle(slots, loads, total_cargo);
+    return loads;
+}
+
+std::optional<std::vector<double>> CargoDistributionEngine::distribute_for_max_speed(const std::vector<CargoSlot>& slots, double total_cargo) {
+    std::vector<double> loads(slots.size(), 0.0);
+    if (total_cargo <= 0) return loads;
+
+    double total_available = 0.0;
+    for (const auto& slot : slots) total_available += slot.available();
+    if (total_cargo > total_available + 1e-9) return std::nullopt;
+
+    // Между точками излома догрузка активного корабля линейна по скорости v: a - b * v
+    std::vector<double> a(slots.size(), 0.0), b(slots.size(), 0.0);
+    std::vector<bool> speed_sensitive(slots.size(), false);
+
+    struct Event {
+        double speed; ///< Скорость, при которой происходит событие
+        size_t index; ///< Индекс корабля
+        bool saturates; ///< false - корабль начинает принимать груз, true - корабль заполнен
+    };
+    std::vector<Event> events;
+    events.reserve(slots.size() * 2);
+    for (size_t i = 0; i < slots.size(); ++i) {
+        const CargoSlot& slot = slots[i];
+        if (slot.available() <= 0) continue;
+        speed_sensitive[i] = slot.speed_reduction_factor > 0 && slot.max_speed > 0 && slot.max_cargo > 0;
+        if (speed_sensitive[i]) {
+            a[i] = slot.max_cargo / slot.speed_reduction_factor - slot.current_cargo;
+            b[i] = slot.max_cargo / (slot.speed_reduction_factor * slot.max_speed);
+        }
+        events.push_back({slot.speed_with(0.0), i, false});
+        events.push_back({slot.speed_with(slot.available()), i, true});
+    }
+    std::sort(events.begin(), events.end(), [](const Event& lhs, const Event& rhs) {
+        if (lhs.speed != rhs.speed) return lhs.speed > rhs.speed;
+        return !lhs.saturates && rhs.saturates;
+    });
+
+    double full = 0.0, a_sum = 0.0, b_sum = 0.0;
+    double upper = std::numeric_limits<double>::max();
+    double level = events.empty() ? 0.0 : events.back().speed;
+    for (size_t k = 0; k < events.size();) {
+        double point = events[k].speed;
+        if (full + a_sum - b_sum * point >= total_cargo) {
+            level = b_sum > 0 ? std::clamp((full + a_sum - total_cargo) / b_sum, point, upper) : upper;
+            break;
+        }
+        for (; k < events.size() && events[k].speed == point; ++k) {
+            size_t i = events[k].index;
+            if (!events[k].saturates) {
+                if (speed_sensitive[i]) {
+                    a_sum += a[i];
+                    b_sum += b[i];
+                }
+            } else {
+                if (speed_sensitive[i]) {
+                    a_sum -= a[i];
+                    b_sum -= b[i];
+                }
+                full += slots[i].available();
+            }
+        }
+        upper = point;
+    }
+
+    for (size_t i = 0; i < slots.size(); ++i) {
+        double available = slots[i].available();
+        if (available <= 0) continue;
+        if (speed_sensitive[i]) loads[i] = std::clamp(a[i] - b[i] * level, 0.0, available);
+        else loads[i] = slots[i].speed_with(0.0) >= level ? available : 0.0;
+    }
+    settle(slots, loads, total_cargo);
+    return loads;
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+/**
+ * @file CargoDistributionEngine.hpp
+ * @brief Заголовочный файл, содержащий определение класса CargoDistributionEngine
+ */
+
+#pragma once
+
+#include <vector>
+#include <optional>
+
+/**
+ * @struct CargoSlot
+ * @brief Снимок грузовых характеристик одного корабля
+ */
+struct CargoSlot {
+    double max_cargo = 0.0; ///< Максимальная грузоподъемность
+    double current_cargo = 0.0; ///< Текущий груз
+    double speed_reduction_factor = 0.0; ///< Коэффициент снижения скорости при полной загрузке
+    double max_speed = 0.0; ///< Максимальная скорость
+
+    /**
+     * @brief Получает свободный объем
+     * @return double Свободный объем
+     */
+    double available() const;
+
+    /**
+     * @brief Вычисляет скорость корабля после догрузки
+     * @param additional_cargo Дополнительный груз
+     * @return double Скорость корабля
+     */
+    double speed_with(double additional_cargo) const;
+};
+
+/**
+ * @class CargoDistributionEngine
+ * @brief Решатель задачи распределения груза между кораблями
+ * @details Работает только со снимками CargoSlot, поэтому не обращается к кораблям во время расчета.
+ * Оба распределения вычисляются за O(n log n) одной сортировкой и проходом по точкам излома.
+ */
+class CargoDistributionEngine {
+    private:
+        /**
+         * @brief Подгоняет сумму догрузок под total_cargo, устраняя погрешность вычислений
+         * @details Избыток снимается пропорционально со всех кораблей, недостаток добирается по кораблям со свободным объемом
+         * @param slots Снимки кораблей
+         * @param loads Догрузка для каждого корабля
+         * @param total_cargo Общее количество груза
+         */
+        static void settle(const std::vector<CargoSlot>& slots, std::vector<double>& loads, double total_cargo);
+    public:
+        /**
+         * @brief Распределяет груз равномерно (метод "заполнения водой")
+         * @details Каждый корабль получает min(свободный объем, уровень), уровень подбирается так, чтобы сумма была равна total_cargo
+         * @param slots Снимки кораблей
+         * @param total_cargo Общее количество груза
+         * @return std::optional<std::vector<double>> Догрузка для каждого корабля или std::nullopt, если груз не помещается
+         */
+        static std::optional<std::vector<double>> distribute_evenly(const std::vector<CargoSlot>& slots, double total_cargo);
+
+        /**
+         * @brief Распределяет груз так, чтобы минимальная скорость кораблей была максимальной
+         * @details Для скорости v каждый корабль может принять груз, не опускающий его скорость ниже v.
+         * Суммарный объем кусочно-линейно убывает по v, поэтому искомая скорость находится проходом по точкам излома.
+         * @param slots Снимки кораблей
+         * @param total_cargo Общее количество груза
+         * @return std::optional<std::vector<double>> Догрузка для каждого корабля или std::nullopt, если груз не помещается
+         */
+        static std::optional<std::vector<double>> distribute_for_max_speed(const std::vector<CargoSlot>& slots, double total_cargo);
+};
\ No newline at end of file
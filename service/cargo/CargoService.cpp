@@ -1,12 +1,43 @@
 #include "CargoService.hpp"
+#include "../../auxiliary/Tracer.hpp"
 #include "../../visitor/cargo/CargoLoadVisitor.hpp"
 #include "../../visitor/cargo/CargoRemovalVisitor.hpp"
 #include "../../visitor/cargo/CargoInfoVisitor.hpp"
+#include "../../entity/ship/Concrete/TransportShip.hpp"
+#include "../../entity/ship/Concrete/GuardShip.hpp"
+#include "../../entity/ship/Concrete/WarShip.hpp"
 #include <limits>
 #include <algorithm>
 
 CargoService::CargoService(Mission& mission, ShipRepository& convoy_repo) : mission_(mission), convoy_repo_(convoy_repo) {}
 
+template <typename Ship>
+CargoSlot CargoService::cargo_slot(Ship* ship) {
+    if constexpr (std::is_base_of_v<DefaultCargo, Ship>) {
+        return {ship->get_max_cargo(), ship->get_cargo(), ship->get_speed_reduction_factor(), ship->get_max_speed()};
+    } else {
+        return {0.0, 0.0, 0.0, ship->get_max_speed()};
+    }
+}
+
+template <typename Ship>
+bool CargoService::load_ship(Ship* ship, double amount) {
+    if constexpr (std::is_base_of_v<DefaultCargo, Ship>) {
+        if (!ship->can_add_cargo(amount)) return false;
+        ship->add_cargo(amount);
+        return true;
+    } else {
+        return false;
+    }
+}
+
+std::vector<ShipVariant> CargoService::to_variants(const std::vector<IShip*>& ships) {
+    std::vector<ShipVariant> variants;
+    variants.reserve(ships.size());
+    for (auto ship : ships) variants.push_back(ship->as_variant());
+    return variants;
+}
+
 bool CargoService::load_cargo(IShip* ship, double amount) {
     if (!ship || amount <= 0) return false;
 
@@ -14,6 +45,7 @@ bool CargoService::load_cargo(IShip* ship, double amount) {
     ship->accept(&visitor);
     if (visitor.is_loaded()) {
         mission_.add_cargo(amount);
+        mission_.touch();
         return true;
     }
     return false;
@@ -25,6 +57,7 @@ bool CargoService::unload_cargo(IShip* ship, double amount) {
     ship->accept(&visitor);
     if (visitor.is_removed()) {
         mission_.remove_cargo(amount);
+        mission_.touch();
         return true;
     }
     return false;
@@ -35,90 +68,54 @@ bool CargoService::auto_distribute_cargo(double total_cargo) {
 }
 
 bool CargoService::distribute_for_max_speed(double total_cargo) {
-    CargoInfoVisitor visitor;
+    TRACE_SPAN("cargo", "CargoService::distribute_for_max_speed");
     if (total_cargo <= 0) return true;
-    
-    auto cargo_ships = convoy_repo_.get_cargo_ships();
+
+    auto cargo_ships = to_variants(convoy_repo_.get_cargo_ships());
     if (cargo_ships.empty()) return false;
-    
-    double total_capacity = 0.0;
-    for (auto ship : cargo_ships) {
-        ship->accept(&visitor);
-        total_capacity += visitor.get_max_cargo();
-    }
-    if (total_cargo > total_capacity) return false;
-    
-    sort_by_speed_factor(cargo_ships, true);
-    
-    double remaining_cargo = total_cargo;
-    for (auto ship : cargo_ships) {
-        if (remaining_cargo <= 0) break;
-            
-        ship->accept(&visitor);
-        double to_load = std::min(remaining_cargo, std::max(0.0, visitor.get_max_cargo() - visitor.get_current_cargo()));
-        if (to_load > 0) {
-            if (load_cargo(ship, to_load)) remaining_cargo -= to_load;
-        }
-    }
-    return remaining_cargo <= 1e-9;
+
+    auto loads = CargoDistributionEngine::distribute_for_max_speed(collect_cargo_slots(cargo_ships), total_cargo);
+    if (!loads) return false;
+    return total_cargo - apply_loads(cargo_ships, *loads) <= 1e-9;
 }
 
 bool CargoService::distribute_evenly(double total_cargo) {
-    CargoInfoVisitor visitor;
+    TRACE_SPAN("cargo", "CargoService::distribute_evenly");
     if (total_cargo <= 0) return true;
 
-    auto cargo_ships = convoy_repo_.get_cargo_ships();
+    auto cargo_ships = to_variants(convoy_repo_.get_cargo_ships());
     if (cargo_ships.empty()) return false;
 
-    double total_capacity = 0.0;
-    for (auto ship : cargo_ships) {
-        ship->accept(&visitor);
-        total_capacity += visitor.get_max_cargo();
-    }
-    if (total_cargo > total_capacity) return false;
-    
-    double cargo_per_ship = total_cargo / (cargo_ships.size());
-    double remaining_cargo = total_cargo;
-    
-    for (auto ship : cargo_ships) {
-        if (remaining_cargo <= 0) break;
-        
-        ship->accept(&visitor);
-        double to_load = std::min(cargo_per_ship, std::max(0.0, visitor.get_max_cargo() - visitor.get_current_cargo()));
-        to_load = std::min(to_load, remaining_cargo);
-        
-        if (to_load > 0) {
-            if (load_cargo(ship, to_load)) remaining_cargo -= to_load;
-        }
+    auto loads = CargoDistributionEngine::distribute_evenly(collect_cargo_slots(cargo_ships), total_cargo);
+    if (!loads) return false;
+    return total_cargo - apply_loads(cargo_ships, *loads) <= 1e-9;
+}
+
+std::vector<CargoSlot> CargoService::collect_cargo_slots(const std::vector<ShipVariant>& ships) const {
+    std::vector<CargoSlot> slots;
+    slots.reserve(ships.size());
+    for (const auto& ship : ships) {
+        slots.push_back(std::visit([](auto* concrete) { return cargo_slot(concrete); }, ship));
     }
-    if (remaining_cargo > 0) {
-        sort_by_available_cargo(cargo_ships, false);
-        for (auto ship : cargo_ships) {
-            if (remaining_cargo <= 0) break;
-            
-            ship->accept(&visitor);
-            double to_load = std::min(remaining_cargo, std::max(0.0, visitor.get_max_cargo() - visitor.get_current_cargo()));
-            if (to_load > 0) {
-                if (load_cargo(ship, to_load)) remaining_cargo -= to_load;
-            }
-        }
+    return slots;
+}
+
+double CargoService::apply_loads(const std::vector<ShipVariant>& ships, const std::vector<double>& loads) {
+    double loaded = 0.0;
+    for (size_t i = 0; i < ships.size(); ++i) {
+        if (loads[i] <= 0) continue;
+        double load = loads[i];
+        if (std::visit([load](auto* concrete) { return load_ship(concrete, load); }, ships[i])) loaded += load;
     }
-    return remaining_cargo <= 1e-9;
+    mission_.add_cargo(loaded);
+    if (loaded > 0) mission_.touch();
+    return loaded;
 }
 
 double CargoService::get_total_cargo_capacity() const {
-    CargoInfoVisitor visitor;
-    auto transport_ships = convoy_repo_.get_ships_by_type("transport");
-    auto war_ships = convoy_repo_.get_ships_by_type("war");
-
     double total_capacity = 0.0;
-    for (auto ship : transport_ships) {
-        ship->accept(&visitor);
-        total_capacity += visitor.get_max_cargo();
-    }
-    for (auto ship : war_ships) {
-        ship->accept(&visitor);
-        total_capacity += visitor.get_max_cargo();
+    for (auto ship : convoy_repo_.get_cargo_ships()) {
+        total_capacity += std::visit([](auto* concrete) { return cargo_slot(concrete).max_cargo; }, ship->as_variant());
     }
     return total_capacity;
 }
@@ -205,30 +202,4 @@ double CargoService::get_ship_available_cargo(IShip* ship) const {
 
 double CargoService::get_required_cargo() const {
     return mission_.get_required_cargo();
-}
-
-void CargoService::sort_by_available_cargo(std::vector<IShip*>& ships, bool ascending) {
-    std::sort(ships.begin(), ships.end(), [ascending](IShip* a, IShip* b) {
-        CargoInfoVisitor visitor;
-        a->accept(&visitor);
-        double a_available_cargo = std::min(0.0, visitor.get_max_cargo() - visitor.get_current_cargo());
-        b->accept(&visitor);
-        double b_available_cargo = std::min(0.0, visitor.get_max_cargo() - visitor.get_current_cargo()); 
-        
-        if (ascending) return a_available_cargo < b_available_cargo;
-        else return a_available_cargo > b_available_cargo;
-    });
-}
-
-void CargoService::sort_by_speed_factor(std::vector<IShip*>& ships, bool ascending) {
-    std::sort(ships.begin(), ships.end(), [ascending](IShip* a, IShip* b) {
-        CargoInfoVisitor visitor;
-        a->accept(&visitor);
-        double a_speed_factor = visitor.get_speed_reduction_factor();
-        b->accept(&visitor);
-        double b_speed_factor = visitor.get_speed_reduction_factor(); 
-        
-        if (ascending) return a_speed_factor < b_speed_factor;
-        else return a_speed_factor > b_speed_factor;
-    });
 }
\ No newline at end of file
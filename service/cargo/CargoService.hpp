@@ -8,6 +8,7 @@
 #include "../../mission/Mission.hpp"
 #include "../../repository/ShipRepository.hpp"
 #include "../../visitor/cargo/CargoInfoVisitor.hpp"
+#include "CargoDistributionEngine.hpp"
 
 /**
  * @class CargoService
@@ -19,18 +20,45 @@ class CargoService {
         ShipRepository& convoy_repo_; ///< Ссылка на репозиторий конвоя
 
         /**
-         * @brief Сортирует корабли по доступной грузоподъемности
-         * @param ships Вектор кораблей для сортировки
-         * @param ascending true для сортировки по возрастанию, false по убыванию (по умолчанию true)
+         * @brief Снимает грузовые характеристики корабля известного типа
+         * @tparam Ship Конкретный тип корабля
+         * @param ship Указатель на корабль
+         * @return CargoSlot Снимок корабля (нулевая грузоподъемность для кораблей без трюма)
          */
-        void sort_by_available_cargo(std::vector<IShip*>& ships, bool ascending = true);
-        
+        template <typename Ship>
+        static CargoSlot cargo_slot(Ship* ship);
+
+        /**
+         * @brief Догружает корабль известного типа, если груз помещается
+         * @tparam Ship Конкретный тип корабля
+         * @param ship Указатель на корабль
+         * @param amount Количество груза
+         * @return bool true если груз загружен, false в противном случае
+         */
+        template <typename Ship>
+        static bool load_ship(Ship* ship, double amount);
+
+        /**
+         * @brief Определяет конкретные типы кораблей за один проход
+         * @param ships Вектор указателей на корабли
+         * @return std::vector<ShipVariant> Корабли в том же порядке
+         */
+        static std::vector<ShipVariant> to_variants(const std::vector<IShip*>& ships);
+
+        /**
+         * @brief Снимает грузовые характеристики кораблей за один проход
+         * @param ships Вектор грузовых кораблей
+         * @return std::vector<CargoSlot> Снимки кораблей в том же порядке
+         */
+        std::vector<CargoSlot> collect_cargo_slots(const std::vector<ShipVariant>& ships) const;
+
         /**
-         * @brief Сортирует корабли по коэффициенту скорости
-         * @param ships Вектор кораблей для сортировки
-         * @param ascending true для сортировки по возрастанию, false по убыванию (по умолчанию true)
+         * @brief Загружает рассчитанный груз на корабли и учитывает его в миссии
+         * @param ships Вектор грузовых кораблей
+         * @param loads Догрузка для каждого корабля
+         * @return double Фактически загруженный груз
          */
-        void sort_by_speed_factor(std::vector<IShip*>& ships, bool ascending = true);
+        double apply_loads(const std::vector<ShipVariant>& ships, const std::vector<double>& loads);
     public:
         /**
          * @brief Конструктор
@@ -64,6 +92,7 @@ class CargoService {
         
         /**
          * @brief Распределяет груз для максимальной скорости конвоя
+         * @details Максимизирует минимальную скорость грузовых кораблей. Если груз не помещается, ничего не загружается
          * @param total_cargo Общее количество груза для распределения
          * @return bool true если распределение успешно, false в противном случае
          */
@@ -71,6 +100,7 @@ class CargoService {
         
         /**
          * @brief Распределяет груз равномерно между кораблями
+         * @details Если груз не помещается, ничего не загружается
          * @param total_cargo Общее количество груза для распределения
          * @return bool true если распределение успешно, false в противном случае
          */
@@ -105,6 +105,7 @@ void ShipCatalog::initialize_default_templates() {
 ShipCatalog::ShipCatalog(std::unique_ptr<ShipFactoryManager> factory_manager) : factory_manager_(std::move(factory_manager)) {
     if (!factory_manager_) throw std::invalid_argument("Factory manager cannot be null");
     initialize_default_templates();
+    for (size_t i = 0; i < templates_.size(); ++i) index_template(i);
 }
 
 void ShipCatalog::add_template(const ShipTemplate& temp) {
@@ -113,28 +114,39 @@ void ShipCatalog::add_template(const ShipTemplate& temp) {
     if (temp.max_health <= 0) throw std::invalid_argument("Max health must be positive");
     if (temp.cost < 0) throw std::invalid_argument("Cost must be positive");
     templates_.push_back(temp);
+    index_template(templates_.size() - 1);
 }
 
-const ShipTemplate* ShipCatalog::find_template_by_id(const std::string& id) const {
-    auto it = std::find_if(templates_.begin(), templates_.end(), [&id](const ShipTemplate& temp) {
-        return temp.id == id;
-    });
-    return it != templates_.end() ? &(*it) : nullptr;
+void ShipCatalog::index_template(size_t index) {
+    const ShipTemplate& temp = templates_[index];
+    id_index_.emplace(temp.id, index);
+    type_index_[temp.type].push_back(index);
+    by_cost_.insert(std::upper_bound(by_cost_.begin(), by_cost_.end(), temp.cost, [this](double value, size_t i) {
+        return value < templates_[i].cost;
+    }), index);
+}
+
+const ShipTemplate* ShipCatalog::find_template_by_id(std::string_view id) const {
+    auto it = id_index_.find(id);
+    return it != id_index_.end() ? &templates_[it->second] : nullptr;
 }
 
-std::vector<const ShipTemplate*> ShipCatalog::find_templates_by_type(const std::string& type) const {
+std::vector<const ShipTemplate*> ShipCatalog::find_templates_by_type(std::string_view type) const {
     std::vector<const ShipTemplate*> result;
-    for (const auto& temp : templates_) {
-        if (temp.type == type) result.push_back(&temp);
-    }
+    auto it = type_index_.find(type);
+    if (it == type_index_.end()) return result;
+    result.reserve(it->second.size());
+    for (size_t index : it->second) result.push_back(&templates_[index]);
     return result;
 }
 
 std::vector<const ShipTemplate*> ShipCatalog::find_affordable_templates(double max_budget) const {
+    auto last = std::upper_bound(by_cost_.begin(), by_cost_.end(), max_budget, [this](double budget, size_t i) {
+        return budget < templates_[i].cost;
+    });
     std::vector<const ShipTemplate*> result;
-    for (const auto& temp : templates_) {
-        if (temp.cost <= max_budget) result.push_back(&temp);
-    }
+    result.reserve(last - by_cost_.begin());
+    for (auto it = by_cost_.begin(); it != last; ++it) result.push_back(&templates_[*it]);
     return result;
 }
 
@@ -158,9 +170,24 @@ std::unique_ptr<IShip> ShipCatalog::create_ship(const std::string& template_id,
     return ship;
 }
 
+std::unique_ptr<IShip> ShipCatalog::create_ship_without_id(const std::string& template_id, bool is_convoy, const Vector& position) const {
+    const ShipTemplate* temp = find_template_by_id(template_id);
+    if (!temp) throw std::runtime_error("Template not found: " + template_id);
+
+    auto ship = temp->create_ship_without_id(factory_manager_.get(), is_convoy);
+    if (ship) {
+        ship->set_convoy(is_convoy);
+        ship->set_position(position);
+    }
+    return ship;
+}
+
 std::vector<std::unique_ptr<IShip>> ShipCatalog::create_ships(const std::string& template_id, size_t count, bool is_convoy) const {
     std::vector<std::unique_ptr<IShip>> ships;
     ships.reserve(count);
+
+    const ShipTemplate* temp = find_template_by_id(template_id);
+    if (temp) factory_manager_->reserve(temp->type, count);
     
     for (size_t i = 0; i < count; ++i) {
         try {
@@ -191,22 +218,17 @@ bool ShipCatalog::validate_purchase(const std::vector<std::string>& template_ids
     return calculate_total_cost(template_ids) <= budget;
 }
 
-size_t ShipCatalog::count_by_type(const std::string& type) const {
-    return std::count_if(templates_.begin(), templates_.end(), [&type](const ShipTemplate& temp) {
-        return temp.type == type;
-    });
+size_t ShipCatalog::count_by_type(std::string_view type) const {
+    auto it = type_index_.find(type);
+    return it != type_index_.end() ? it->second.size() : 0;
 }
 
 double ShipCatalog::get_min_cost() const {
-    if (templates_.empty()) return 0.0;
-    return std::min_element(templates_.begin(), templates_.end(), [](const ShipTemplate& a, const ShipTemplate& b) {
-        return a.cost < b.cost;
-    })->cost;
+    if (by_cost_.empty()) return 0.0;
+    return templates_[by_cost_.front()].cost;
 }
 
 double ShipCatalog::get_max_cost() const {
-    if (templates_.empty()) return 0.0;
-    return std::max_element(templates_.begin(), templates_.end(), [](const ShipTemplate& a, const ShipTemplate& b) {
-        return a.cost < b.cost;
-    })->cost;
+    if (by_cost_.empty()) return 0.0;
+    return templates_[by_cost_.back()].cost;
 }
\ No newline at end of file
@@ -6,7 +6,10 @@
 #pragma once
 
 #include "ShipTemplate.hpp"
+#include "../../../template/StringHash.hpp"
 #include <vector>
+#include <unordered_map>
+#include <string_view>
 
 /**
  * @class ShipCatalog
@@ -16,11 +19,20 @@ class ShipCatalog {
     private:
         std::vector<ShipTemplate> templates_; ///< Вектор шаблонов кораблей
         std::unique_ptr<ShipFactoryManager> factory_manager_; ///< Менеджер фабрик кораблей
+        std::unordered_map<std::string, size_t, StringHash, std::equal_to<>> id_index_; ///< Индекс шаблонов по идентификатору
+        std::unordered_map<std::string, std::vector<size_t>, StringHash, std::equal_to<>> type_index_; ///< Индекс шаблонов по типу
+        std::vector<size_t> by_cost_; ///< Индексы шаблонов, отсортированные по возрастанию стоимости
 
         /**
          * @brief Инициализирует шаблоны кораблей по умолчанию
          */
         void initialize_default_templates();
+
+        /**
+         * @brief Добавляет шаблон во все индексы
+         * @param index Позиция шаблона в векторе шаблонов
+         */
+        void index_template(size_t index);
     public:
         /**
          * @brief Конструктор
@@ -39,19 +51,19 @@ class ShipCatalog {
          * @param id Идентификатор шаблона
          * @return const ShipTemplate* Указатель на найденный шаблон или nullptr
          */
-        const ShipTemplate* find_template_by_id(const std::string& id) const;
+        const ShipTemplate* find_template_by_id(std::string_view id) const;
         
         /**
          * @brief Находит шаблоны по типу
          * @param type Тип корабля
          * @return std::vector<const ShipTemplate*> Вектор указателей на найденные шаблоны
          */
-        std::vector<const ShipTemplate*> find_templates_by_type(const std::string& type) const;
+        std::vector<const ShipTemplate*> find_templates_by_type(std::string_view type) const;
         
         /**
          * @brief Находит доступные шаблоны по бюджету
          * @param max_budget Максимальный бюджет
-         * @return std::vector<const ShipTemplate*> Вектор указателей на доступные шаблоны
+         * @return std::vector<const ShipTemplate*> Вектор указателей на доступные шаблоны в порядке возрастания стоимости
          */
         std::vector<const ShipTemplate*> find_affordable_templates(double max_budget) const;
         
@@ -75,6 +87,16 @@ class ShipCatalog {
          * @return std::unique_ptr<IShip> Указатель на созданный корабль
          */
         std::unique_ptr<IShip> create_ship(const std::string& template_id, bool is_convoy = true, const Vector& position = Vector(0, 0)) const;
+
+        /**
+         * @brief Создает корабль на основе шаблона без генерации идентификатора (например, прототип для клонирования)
+         * @param template_id Идентификатор шаблона
+         * @param is_convoy Флаг принадлежности к конвою (по умолчанию true)
+         * @param position Позиция корабля (по умолчанию (0, 0))
+         * @return std::unique_ptr<IShip> Указатель на созданный корабль с пустым идентификатором
+         * @throws std::runtime_error Если шаблон не найден
+         */
+        std::unique_ptr<IShip> create_ship_without_id(const std::string& template_id, bool is_convoy = true, const Vector& position = Vector(0, 0)) const;
         
         /**
          * @brief Создает несколько кораблей на основе шаблона
@@ -112,7 +134,7 @@ class ShipCatalog {
          * @param type Тип корабля
          * @return size_t Количество шаблонов заданного типа
          */
-        size_t count_by_type(const std::string& type) const;
+        size_t count_by_type(std::string_view type) const;
         
         /**
          * @brief Получает минимальную стоимость среди всех шаблонов
@@ -7,6 +7,11 @@ std::unique_ptr<IShip> ShipTemplate::create_ship(ShipFactoryManager* factory_man
     return factory_manager->create_ship(type, display_name, default_captain, max_speed, max_health, cost, is_convoy, max_cargo, Vector(0, 0));
 }
 
+std::unique_ptr<IShip> ShipTemplate::create_ship_without_id(ShipFactoryManager* factory_manager, bool is_convoy) const {
+    if (!factory_manager) throw std::invalid_argument("Factory manager is null");
+    return factory_manager->create_ship_without_id(type, display_name, default_captain, max_speed, max_health, cost, is_convoy, max_cargo, Vector(0, 0));
+}
+
 std::string ShipTemplate::get_description() const {
     std::ostringstream oss;
     oss << display_name << ": " 
@@ -32,6 +32,14 @@ struct ShipTemplate {
      * @return std::unique_ptr<IShip> Указатель на созданный корабль
      */
     std::unique_ptr<IShip> create_ship(ShipFactoryManager* factory_manager, bool is_convoy) const;
+
+    /**
+     * @brief Создает корабль на основе шаблона без генерации идентификатора
+     * @param factory_manager Менеджер фабрик кораблей
+     * @param is_convoy Флаг принадлежности к конвою
+     * @return std::unique_ptr<IShip> Указатель на созданный корабль с пустым идентификатором
+     */
+    std::unique_ptr<IShip> create_ship_without_id(ShipFactoryManager* factory_manager, bool is_convoy) const;
     
     /**
      * @brief Получает описание шаблона
@@ -74,6 +74,7 @@ void WeaponCatalog::initialize_default_templates() {
 WeaponCatalog::WeaponCatalog(std::unique_ptr<WeaponFactoryManager> factory_manager) : factory_manager_(std::move(factory_manager)) {
     if (!factory_manager_) throw std::invalid_argument("Factory manager cannot be null");
     initialize_default_templates();
+    for (size_t i = 0; i < templates_.size(); ++i) index_template(i);
 }
 
 void WeaponCatalog::add_template(const WeaponTemplate& temp) {
@@ -85,44 +86,65 @@ void WeaponCatalog::add_template(const WeaponTemplate& temp) {
     if (temp.cost < 0) throw std::invalid_argument("Cost must be positive");
     if (temp.accuracy < 0 || temp.accuracy > 1) throw std::invalid_argument("Accuracy must be between 0 and 1");
     templates_.push_back(temp);
+    index_template(templates_.size() - 1);
 }
 
-const WeaponTemplate* WeaponCatalog::find_template_by_id(const std::string& id) const {
-    auto it = std::find_if(templates_.begin(), templates_.end(), [&id](const WeaponTemplate& temp) {
-        return temp.id == id;
-    });
-    return it != templates_.end() ? &(*it) : nullptr;
+void WeaponCatalog::index_template(size_t index) {
+    const WeaponTemplate& temp = templates_[index];
+    id_index_.emplace(temp.id, index);
+    type_index_[temp.type].push_back(index);
+    by_cost_.insert(std::upper_bound(by_cost_.begin(), by_cost_.end(), temp.cost, [this](double value, size_t i) {
+        return value < templates_[i].cost;
+    }), index);
+    by_damage_.insert(std::upper_bound(by_damage_.begin(), by_damage_.end(), temp.damage, [this](double value, size_t i) {
+        return value < templates_[i].damage;
+    }), index);
+    by_range_.insert(std::upper_bound(by_range_.begin(), by_range_.end(), temp.range, [this](double value, size_t i) {
+        return value < templates_[i].range;
+    }), index);
+}
+
+const WeaponTemplate* WeaponCatalog::find_template_by_id(std::string_view id) const {
+    auto it = id_index_.find(id);
+    return it != id_index_.end() ? &templates_[it->second] : nullptr;
 }
 
-std::vector<const WeaponTemplate*> WeaponCatalog::find_templates_by_type(const std::string& type) const {
+std::vector<const WeaponTemplate*> WeaponCatalog::find_templates_by_type(std::string_view type) const {
     std::vector<const WeaponTemplate*> result;
-    for (const auto& temp : templates_) {
-        if (temp.type == type) result.push_back(&temp);
-    }
+    auto it = type_index_.find(type);
+    if (it == type_index_.end()) return result;
+    result.reserve(it->second.size());
+    for (size_t index : it->second) result.push_back(&templates_[index]);
     return result;
 }
 
 std::vector<const WeaponTemplate*> WeaponCatalog::find_affordable_templates(double max_budget) const {
+    auto last = std::upper_bound(by_cost_.begin(), by_cost_.end(), max_budget, [this](double budget, size_t i) {
+        return budget < templates_[i].cost;
+    });
     std::vector<const WeaponTemplate*> result;
-    for (const auto& temp : templates_) {
-        if (temp.cost <= max_budget) result.push_back(&temp);
-    }
+    result.reserve(last - by_cost_.begin());
+    for (auto it = by_cost_.begin(); it != last; ++it) result.push_back(&templates_[*it]);
     return result;
 }
 
 std::vector<const WeaponTemplate*> WeaponCatalog::find_by_min_damage(double min_damage) const {
+    auto first = std::lower_bound(by_damage_.begin(), by_damage_.end(), min_damage, [this](size_t i, double value) {
+        return templates_[i].damage < value;
+    });
     std::vector<const WeaponTemplate*> result;
-    for (const auto& temp : templates_) {
-        if (temp.damage >= min_damage) result.push_back(&temp);
-    }
+    result.reserve(by_damage_.end() - first);
+    for (auto it = first; it != by_damage_.end(); ++it) result.push_back(&templates_[*it]);
     return result;
 }
 
 std::vector<const WeaponTemplate*> WeaponCatalog::find_by_min_range(double min_range) const {
+    auto first = std::lower_bound(by_range_.begin(), by_range_.end(), min_range, [this](size_t i, double value) {
+        return templates_[i].range < value;
+    });
     std::vector<const WeaponTemplate*> result;
-    for (const auto& temp : templates_) {
-        if (temp.range >= min_range) result.push_back(&temp);
-    }
+    result.reserve(by_range_.end() - first);
+    for (auto it = first; it != by_range_.end(); ++it) result.push_back(&templates_[*it]);
     return result;
 }
 
@@ -144,6 +166,9 @@ std::unique_ptr<IWeapon> WeaponCatalog::create_weapon(const std::string& templat
 std::vector<std::unique_ptr<IWeapon>> WeaponCatalog::create_weapons(const std::string& template_id, size_t count) const {
     std::vector<std::unique_ptr<IWeapon>> weapons;
     weapons.reserve(count);
+
+    const WeaponTemplate* temp = find_template_by_id(template_id);
+    if (temp) factory_manager_->reserve(temp->type, count);
     
     for (size_t i = 0; i < count; ++i) {
         try {
@@ -173,36 +198,27 @@ bool WeaponCatalog::validate_purchase(const std::vector<std::string>& template_i
     return calculate_total_cost(template_ids) <= budget;
 }
 
-size_t WeaponCatalog::count_by_type(const std::string& type) const {
-    return std::count_if(templates_.begin(), templates_.end(), [&type](const WeaponTemplate& temp) {
-        return temp.type == type;
-    });
+size_t WeaponCatalog::count_by_type(std::string_view type) const {
+    auto it = type_index_.find(type);
+    return it != type_index_.end() ? it->second.size() : 0;
 }
 
 double WeaponCatalog::get_min_cost() const {
-    if (templates_.empty()) return 0.0;
-    return std::min_element(templates_.begin(), templates_.end(), [](const WeaponTemplate& a, const WeaponTemplate& b) {
-        return a.cost < b.cost;
-    })->cost;
+    if (by_cost_.empty()) return 0.0;
+    return templates_[by_cost_.front()].cost;
 }
 
 double WeaponCatalog::get_max_cost() const {
-    if (templates_.empty()) return 0.0;
-    return std::max_element(templates_.begin(), templates_.end(), [](const WeaponTemplate& a, const WeaponTemplate& b) {
-        return a.cost < b.cost;
-    })->cost;
+    if (by_cost_.empty()) return 0.0;
+    return templates_[by_cost_.back()].cost;
 }
 
 double WeaponCatalog::get_max_damage() const {
-    if (templates_.empty()) return 0.0;
-    return std::max_element(templates_.begin(), templates_.end(), [](const WeaponTemplate& a, const WeaponTemplate& b) {
-        return a.damage < b.damage;
-    })->damage;
+    if (by_damage_.empty()) return 0.0;
+    return templates_[by_damage_.back()].damage;
 }
 
 double WeaponCatalog::get_max_range() const {
-    if (templates_.empty()) return 0.0;
-    return std::max_element(templates_.begin(), templates_.end(), [](const WeaponTemplate& a, const WeaponTemplate& b) {
-        return a.range < b.range;
-    })->range;
+    if (by_range_.empty()) return 0.0;
+    return templates_[by_range_.back()].range;
 }
\ No newline at end of file
@@ -6,7 +6,10 @@
 #pragma once
 
 #include "WeaponTemplate.hpp"
+#include "../../../template/StringHash.hpp"
 #include <vector>
+#include <unordered_map>
+#include <string_view>
 
 /**
  * @class WeaponCatalog
@@ -16,11 +19,22 @@ class WeaponCatalog {
     private:
         std::vector<WeaponTemplate> templates_; ///< Вектор шаблонов оружия
         std::unique_ptr<WeaponFactoryManager> factory_manager_; ///< Менеджер фабрик оружия
+        std::unordered_map<std::string, size_t, StringHash, std::equal_to<>> id_index_; ///< Индекс шаблонов по идентификатору
+        std::unordered_map<std::string, std::vector<size_t>, StringHash, std::equal_to<>> type_index_; ///< Индекс шаблонов по типу
+        std::vector<size_t> by_cost_; ///< Индексы шаблонов, отсортированные по возрастанию стоимости
+        std::vector<size_t> by_damage_; ///< Индексы шаблонов, отсортированные по возрастанию урона
+        std::vector<size_t> by_range_; ///< Индексы шаблонов, отсортированные по возрастанию дальности
 
         /**
          * @brief Инициализирует шаблоны оружия по умолчанию
          */
         void initialize_default_templates();
+
+        /**
+         * @brief Добавляет шаблон во все индексы
+         * @param index Позиция шаблона в векторе шаблонов
+         */
+        void index_template(size_t index);
     public:
         /**
          * @brief Конструктор
@@ -39,33 +53,33 @@ class WeaponCatalog {
          * @param id Идентификатор шаблона
          * @return const WeaponTemplate* Указатель на найденный шаблон или nullptr
          */
-        const WeaponTemplate* find_template_by_id(const std::string& id) const;
+        const WeaponTemplate* find_template_by_id(std::string_view id) const;
         
         /**
          * @brief Находит шаблоны по типу
          * @param type Тип оружия
          * @return std::vector<const WeaponTemplate*> Вектор указателей на найденные шаблоны
          */
-        std::vector<const WeaponTemplate*> find_templates_by_type(const std::string& type) const;
+        std::vector<const WeaponTemplate*> find_templates_by_type(std::string_view type) const;
         
         /**
          * @brief Находит доступные шаблоны по бюджету
          * @param max_budget Максимальный бюджет
-         * @return std::vector<const WeaponTemplate*> Вектор указателей на доступные шаблоны
+         * @return std::vector<const WeaponTemplate*> Вектор указателей на доступные шаблоны в порядке возрастания стоимости
          */
         std::vector<const WeaponTemplate*> find_affordable_templates(double max_budget) const;
         
         /**
          * @brief Находит шаблоны с минимальным уроном
          * @param min_damage Минимальный урон
-         * @return std::vector<const WeaponTemplate*> Вектор указателей на найденные шаблоны
+         * @return std::vector<const WeaponTemplate*> Вектор указателей на найденные шаблоны в порядке возрастания урона
          */
         std::vector<const WeaponTemplate*> find_by_min_damage(double min_damage) const;
         
         /**
          * @brief Находит шаблоны с минимальной дальностью
          * @param min_range Минимальная дальность
-         * @return std::vector<const WeaponTemplate*> Вектор указателей на найденные шаблоны
+         * @return std::vector<const WeaponTemplate*> Вектор указателей на найденные шаблоны в порядке возрастания дальности
          */
         std::vector<const WeaponTemplate*> find_by_min_range(double min_range) const;
 
@@ -123,7 +137,7 @@ class WeaponCatalog {
          * @param type Тип оружия
          * @return size_t Количество шаблонов заданного типа
          */
-        size_t count_by_type(const std::string& type) const;
+        size_t count_by_type(std::string_view type) const;
         
         /**
          * @brief Получает минимальную стоимость среди всех шаблонов
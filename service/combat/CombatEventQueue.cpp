@@ -0,0 +1,43 @@
+#include "CombatEventQueue.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+bool CombatEventQueue::later(const Entry& a, const Entry& b) {
+    if (a.event.time != b.event.time) return a.event.time > b.event.time;
+    return a.sequence > b.sequence;
+}
+
+void CombatEventQueue::push(const CombatEvent& event) {
+    heap_.push_back({event, next_sequence_++});
+    std::push_heap(heap_.begin(), heap_.end(), later);
+}
+
+double CombatEventQueue::next_time() const {
+    if (heap_.empty()) throw std::runtime_error("Combat event queue is empty");
+    return heap_.front().event.time;
+}
+
+size_t CombatEventQueue::pop_batch(std::vector<CombatEvent>& batch) {
+    batch.clear();
+    if (heap_.empty()) return 0;
+
+    double time = heap_.front().event.time;
+    while (!heap_.empty() && heap_.front().event.time - time <= time_epsilon) {
+        std::pop_heap(heap_.begin(), heap_.end(), later);
+        batch.push_back(heap_.back().event);
+        heap_.pop_back();
+    }
+    return batch.size();
+}
+
+bool CombatEventQueue::empty() const {
+    return heap_.empty();
+}
+
+size_t CombatEventQueue::size() const {
+    return heap_.size();
+}
+
+void CombatEventQueue::clear() {
+    heap_.clear();
+}
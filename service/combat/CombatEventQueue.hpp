@@ -0,0 +1,103 @@
+/**
+ * @file CombatEventQueue.hpp
+ * @brief Заголовочный файл, содержащий определение класса CombatEventQueue
+ */
+
+#pragma once
+
+#include "../../entity/ship/Interfaces/IShip.hpp"
+#include "../../auxiliary/PlaceForWeapon.hpp"
+#include <vector>
+#include <cstdint>
+
+class DefaultGuard;
+
+/**
+ * @enum CombatSide
+ * @brief Сторона боя
+ */
+enum class CombatSide {
+    convoy, ///< Конвой
+    pirates ///< Пираты
+};
+
+/**
+ * @struct CombatEvent
+ * @brief Запланированный выстрел одного оружия
+ */
+struct CombatEvent {
+    double time = 0.0; ///< Модельное время выстрела
+    IShip* attacker = nullptr; ///< Атакующий корабль
+    PlaceForWeapon place = PlaceForWeapon::bow; ///< Место оружия
+    CombatSide side = CombatSide::convoy; ///< Сторона атакующего корабля
+    size_t shot = 0; ///< Порядковый номер выстрела оружия (время выстрела равно shot / fire_rate)
+    DefaultGuard* guard = nullptr; ///< Вооружение атакующего корабля, определенное один раз при планировании
+};
+
+/**
+ * @class CombatEventQueue
+ * @brief Очередь с приоритетом для событий боя, упорядоченная по модельному времени
+ * @details События с одинаковым временем извлекаются одной пачкой в порядке добавления,
+ * поэтому их можно обрабатывать параллельно, а результат не зависит от устройства кучи.
+ */
+class CombatEventQueue {
+    private:
+        /**
+         * @struct Entry
+         * @brief Событие и его порядковый номер добавления
+         */
+        struct Entry {
+            CombatEvent event; ///< Событие
+            uint64_t sequence; ///< Порядковый номер добавления
+        };
+
+        std::vector<Entry> heap_; ///< Двоичная куча событий
+        uint64_t next_sequence_ = 0; ///< Порядковый номер следующего события
+
+        /**
+         * @brief Проверяет, должно ли событие a быть извлечено позже события b
+         * @param a Первое событие
+         * @param b Второе событие
+         * @return bool true если a позже b, false в противном случае
+         */
+        static bool later(const Entry& a, const Entry& b);
+    public:
+        static constexpr double time_epsilon = 1e-9; ///< Допуск при сравнении времени событий
+
+        /**
+         * @brief Добавляет событие в очередь
+         * @param event Событие
+         */
+        void push(const CombatEvent& event);
+
+        /**
+         * @brief Получает время ближайшего события
+         * @return double Время ближайшего события
+         * @throws std::runtime_error Если очередь пуста
+         */
+        double next_time() const;
+
+        /**
+         * @brief Извлекает все события с временем ближайшего события
+         * @param batch Вектор для извлеченных событий (предварительно очищается)
+         * @return size_t Количество извлеченных событий
+         */
+        size_t pop_batch(std::vector<CombatEvent>& batch);
+
+        /**
+         * @brief Проверяет, пуста ли очередь
+         * @return bool true если очередь пуста, false в противном случае
+         */
+        bool empty() const;
+
+        /**
+         * @brief Получает количество событий в очереди
+         * @return size_t Количество событий
+         */
+        size_t size() const;
+
+        /**
+         * @brief Удаляет все события
+         */
+        void clear();
+};
@@ -1,7 +1,9 @@
 #include "CombatService.hpp"
-#include "../../visitor/weapon/ShootingVisitor.hpp"
-#include "../../visitor/cargo/CargoInfoVisitor.hpp"
-#include "../../visitor/cargo/CargoRemovalVisitor.hpp"
+#include "../../auxiliary/Tracer.hpp"
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
 
 std::vector<IShip*> CombatService::get_convoy_ships_safe() const {
     return convoy_repo_.get_alive_ships();
@@ -11,117 +13,240 @@ std::vector<IShip*> CombatService::get_pirate_ships_safe() const {
     return pirate_repo_.get_alive_ships();
 }
 
-bool CombatService::execute_attack(IShip* attacker, IShip* target) {
-    if (!attacker || !target) return false;
-    if (!attacker->is_alive() || !target->is_alive()) return false;
-    
-    std::optional<PlaceForWeapon> place = PlaceForWeapon::bow;
-    if (convoy_strategy_ && attacker->is_convoy()) place = convoy_strategy_->select_weapon_place(attacker, target);
-    else if (pirate_strategy_ && !attacker->is_convoy()) place = pirate_strategy_->select_weapon_place(attacker, target);
-    
-    if (place.has_value()) {
-        ShootingVisitor shooting_visitor(place.value(), target, damage_service_);
-        attacker->accept(&shooting_visitor);
-        return shooting_visitor.shot_fired();
+bool CombatService::resolve_shot(DefaultGuard& guard, PlaceForWeapon place, IShip* target, double distance, TargetBoard& targets, CombatSide side, TelemetrySlot& stats) {
+    const IWeapon* weapon = guard.get_weapon_in_place(place);
+    if (!weapon) return false;
+    double explosion_radius = weapon->get_explosion_radius();
+    bool lose_cargo = side == CombatSide::pirates;
+
+    HitResult hit = HitResolver::resolve(guard, place, target, distance, damage_service_, lose_cargo);
+    if (!hit.fired) return false;
+    bool record = telemetry_.is_enabled();
+    if (record) stats.record_shot(weapon->get_type(), hit, side);
+    if (hit.cargo_lost > 0.0) mission_.remove_cargo(hit.cargo_lost);
+    targets.update(target);
+
+    if (hit.damage > 0.0 && explosion_radius > 0.0) {
+        Vector impact = target->get_position();
+        for (IShip* ship : targets.alive_in_radius(impact, explosion_radius)) {
+            if (ship == target) continue;
+            double splash = damage_service_.calculate_splash_damage(hit.damage, ship->get_distance_to(impact), explosion_radius);
+            if (splash <= 0.0) continue;
+
+            HitResult splash_hit = HitResolver::apply_damage(ship, splash, lose_cargo);
+            if (record) stats.record_splash(splash_hit, side);
+            if (splash_hit.cargo_lost > 0.0) mission_.remove_cargo(splash_hit.cargo_lost);
+            targets.update(ship);
+        }
     }
-    
-    return false;
+    return true;
 }
 
-void CombatService::process_convoy_attack_range(size_t start, size_t end, const std::vector<IShip*>& convoy_ships, const std::vector<IShip*>& pirate_ships) {    
-    if (convoy_ships.empty() || pirate_ships.empty()) return;
-    
+template <typename Targeting>
+bool CombatService::strike(const Targeting& targeting, const Attacker& attacker, IShip* target, TargetBoard& targets, CombatSide side, TelemetrySlot& stats) {
+    if (!attacker.ship->is_alive() || !target->is_alive()) return false;
+
+    double distance = attacker.ship->get_distance_to(target->get_position());
+    std::optional<PlaceForWeapon> place;
+    {
+        TRACE_SPAN("strategy", "select_weapon_place");
+        place = targeting.select_weapon_place(attacker.ship, attacker.guard, target, distance);
+    }
+    if (!place.has_value() || !attacker.guard) return false;
+
+    return resolve_shot(*attacker.guard, place.value(), target, distance, targets, side, stats);
+}
+
+template <typename Targeting>
+bool CombatService::fire_event(const Targeting& targeting, const CombatEvent& event, TargetBoard& targets, TelemetrySlot& stats) {
+    if (!event.guard) return false;
+
+    IShip* target = targeting.select_target(event.attacker, targets);
+    if (!target || !target->is_alive()) return false;
+
+    double distance = event.attacker->get_distance_to(target->get_position());
+    return resolve_shot(*event.guard, event.place, target, distance, targets, event.side, stats);
+}
+
+void CombatService::schedule_weapons(const std::vector<IShip*>& ships, CombatSide side, CombatEventQueue& queue) const {
+    for (auto ship : ships) {
+        DefaultGuard* guard = dynamic_cast<DefaultGuard*>(ship);
+        if (!guard || !ship->is_alive()) continue;
+        for (auto place : {PlaceForWeapon::bow, PlaceForWeapon::stern, PlaceForWeapon::port, PlaceForWeapon::starboard}) {
+            const IWeapon* weapon = guard->get_weapon_in_place(place);
+            if (!weapon || weapon->get_current_ammo() == 0 || weapon->get_fire_rate() == 0) continue;
+            queue.push(CombatEvent{0.0, ship, place, side, 0, guard});
+        }
+    }
+}
+
+std::optional<CombatEvent> CombatService::resolve_event(const CombatEvent& event, double duration, TargetBoard& convoy_targets, TargetBoard& pirate_targets, TelemetrySlot& stats, size_t& shots) {
+    if (!event.attacker || !event.attacker->is_alive()) return std::nullopt;
+
+    bool fired = false;
+    if (event.side == CombatSide::convoy) {
+        fired = std::visit([&](const auto& targeting) {
+            return fire_event(targeting, event, pirate_targets, stats);
+        }, convoy_targeting_);
+    } else {
+        fired = std::visit([&](const auto& targeting) {
+            return fire_event(targeting, event, convoy_targets, stats);
+        }, pirate_targeting_);
+    }
+    if (fired) ++shots;
+
+    const IWeapon* weapon = event.guard ? event.guard->get_weapon_in_place(event.place) : nullptr;
+    if (!weapon || weapon->get_current_ammo() == 0 || !event.attacker->is_alive()) return std::nullopt;
+
+    CombatEvent next = event;
+    next.shot = event.shot + 1;
+    next.time = static_cast<double>(next.shot) / static_cast<double>(weapon->get_fire_rate());
+    if (next.time >= duration) return std::nullopt;
+    return next;
+}
+
+template <typename Targeting>
+size_t CombatService::convoy_attack_range(const Targeting& targeting, size_t start, size_t end, const std::vector<Attacker>& convoy_ships, TargetBoard& pirate_targets, TelemetrySlot& stats) {
+    size_t shots = 0;
     for (size_t i = start; i < end && i < convoy_ships.size(); ++i) {
-        if (stop_threads_.load()) return;
+        if (stop_threads_.load()) break;
         
-        IShip* attacker = convoy_ships[i];
-        if (!attacker || !attacker->is_alive() || attacker->get_health() <= 0.0) continue;
+        const Attacker& attacker = convoy_ships[i];
+        if (!attacker.ship->is_alive() || attacker.ship->get_health() <= 0.0) continue;
         
-        IShip* target = convoy_strategy_->select_target(attacker, pirate_ships);
+        IShip* target = nullptr;
+        {
+            TRACE_SPAN("strategy", "select_target");
+            target = targeting.select_target(attacker.ship, pirate_targets);
+        }
         if (!target) continue;
         
-        execute_attack(attacker, target);
+        if (strike(targeting, attacker, target, pirate_targets, CombatSide::convoy, stats)) ++shots;
     }
-
-    // std::cout << "Поток конвоя id: " << std::this_thread::get_id() << "\n";
+    return shots;
 }
 
-void CombatService::process_pirate_attack_range(size_t start, size_t end, const std::vector<IShip*>& convoy_ships, const std::vector<IShip*>& pirate_ships) {
-    if (convoy_ships.empty() || pirate_ships.empty()) return;
-    
+template <typename Targeting>
+size_t CombatService::pirate_attack_range(const Targeting& targeting, size_t start, size_t end, const std::vector<Attacker>& pirate_ships, TargetBoard& convoy_targets, TelemetrySlot& stats) {
+    size_t shots = 0;
     for (size_t i = start; i < end && i < pirate_ships.size(); ++i) {
-        if (stop_threads_.load()) return;
+        if (stop_threads_.load()) break;
         
-        IShip* attacker = pirate_ships[i];
-        if (!attacker|| !attacker->is_alive() || attacker->get_health() <= 0.0) continue;
+        const Attacker& attacker = pirate_ships[i];
+        if (!attacker.ship->is_alive() || attacker.ship->get_health() <= 0.0) continue;
         
-        IShip* target = pirate_strategy_->select_target(attacker, convoy_ships);
+        IShip* target = nullptr;
+        {
+            TRACE_SPAN("strategy", "select_target");
+            target = targeting.select_target(attacker.ship, convoy_targets);
+        }
         if (!target || !target->is_alive() || target->get_health() <= 0.0) continue;
 
-        double health_before = target->get_health();
-        if (!execute_attack(attacker, target)) continue;
-        double health_after = target->get_health();
-
-        if (health_after < health_before) {
-            CargoInfoVisitor info_visitor;
-            target->accept(&info_visitor);
-            double current_cargo = info_visitor.get_current_cargo();
-            
-            double damage_percent = (health_before - health_after) / health_before;
-            double cargo_to_remove = current_cargo * damage_percent;
-            
-            if (cargo_to_remove > 0) {
-                {
-                    std::lock_guard<std::mutex> lock(mission_mutex_);
-                    mission_.remove_cargo(cargo_to_remove);
+        if (strike(targeting, attacker, target, convoy_targets, CombatSide::pirates, stats)) ++shots;
+    }
+    return shots;
+}
+
+size_t CombatService::process_convoy_attack_range(size_t start, size_t end, const std::vector<Attacker>& convoy_ships, TargetBoard& pirate_targets, TelemetrySlot& stats) {
+    TRACE_SPAN("combat", "CombatService::process_convoy_attack_range");
+    if (convoy_ships.empty() || pirate_targets.alive_count() == 0) return 0;
+    return std::visit([&](const auto& targeting) {
+        return convoy_attack_range(targeting, start, end, convoy_ships, pirate_targets, stats);
+    }, convoy_targeting_);
+}
+
+size_t CombatService::process_pirate_attack_range(size_t start, size_t end, const std::vector<Attacker>& pirate_ships, TargetBoard& convoy_targets, TelemetrySlot& stats) {
+    TRACE_SPAN("combat", "CombatService::process_pirate_attack_range");
+    if (pirate_ships.empty() || convoy_targets.alive_count() == 0) return 0;
+    return std::visit([&](const auto& targeting) {
+        return pirate_attack_range(targeting, start, end, pirate_ships, convoy_targets, stats);
+    }, pirate_targeting_);
+}
+
+size_t CombatService::run_round(const std::vector<Attacker>& convoy_attackers, const std::vector<Attacker>& pirate_attackers, const std::vector<IShip*>& convoy_ships, const std::vector<IShip*>& pirate_ships, bool parallel) {
+    TRACE_SPAN("combat", "CombatService::run_round");
+    if (!parallel) {
+        TargetBoard pirate_targets(pirate_ships);
+        size_t shots = process_convoy_attack_range(0, convoy_attackers.size(), convoy_attackers, pirate_targets, telemetry_.slot(0));
+        TargetBoard convoy_targets(convoy_ships);
+        shots += process_pirate_attack_range(0, pirate_attackers.size(), pirate_attackers, convoy_targets, telemetry_.slot(0));
+        telemetry_.end_round();
+        return shots;
+    }
+
+    stop_threads_.store(false);
+    
+    TargetBoard convoy_targets(convoy_ships);
+    TargetBoard pirate_targets(pirate_ships);
+    std::vector<size_t> shots(CombatTelemetry::worker_slot_count, 0);
+
+    {
+        std::vector<std::jthread> threads;
+        
+        size_t convoy_workers = worker_count(convoy_attackers.size(), CombatTelemetry::max_workers_per_side, 2);
+        size_t convoy_chunk_size = (convoy_attackers.size() + convoy_workers - 1) / convoy_workers;
+        for (size_t i = 0; i < convoy_workers; ++i) {
+            size_t start_index = i * convoy_chunk_size;
+            size_t end_index = std::min(start_index + convoy_chunk_size, convoy_attackers.size());
+
+            if (start_index >= convoy_attackers.size()) break;
+
+            TelemetrySlot& stats = telemetry_.worker_slot(i);
+            size_t& worker_shots = shots[i];
+            threads.emplace_back(
+                [this, start_index, end_index, &convoy_attackers, &pirate_targets, &stats, &worker_shots](){
+                    worker_shots = this->process_convoy_attack_range(start_index, end_index, convoy_attackers, pirate_targets, stats);
                 }
+            );
+        }
 
-                CargoRemovalVisitor remove_visitor(cargo_to_remove);
-                target->accept(&remove_visitor);
-            }
+        size_t pirate_workers = worker_count(pirate_attackers.size(), CombatTelemetry::max_workers_per_side, 2);
+        size_t pirate_chunk_size = (pirate_attackers.size() + pirate_workers - 1) / pirate_workers;
+        for (size_t i = 0; i < pirate_workers; ++i) {
+            size_t start_index = i * pirate_chunk_size;
+            size_t end_index = std::min(start_index + pirate_chunk_size, pirate_attackers.size());
+
+            if (start_index >= pirate_attackers.size()) break;
+
+            TelemetrySlot& stats = telemetry_.worker_slot(CombatTelemetry::max_workers_per_side + i);
+            size_t& worker_shots = shots[CombatTelemetry::max_workers_per_side + i];
+            threads.emplace_back(
+                [this, start_index, end_index, &pirate_attackers, &convoy_targets, &stats, &worker_shots](){
+                    worker_shots = this->process_pirate_attack_range(start_index, end_index, pirate_attackers, convoy_targets, stats);
+                }
+            );
         }
     }
+    telemetry_.end_round();
+    return std::accumulate(shots.begin(), shots.end(), size_t(0));
+}
 
-    // std::cout << "Поток пиратов id: " << std::this_thread::get_id() << "\n";
+size_t CombatService::worker_count(size_t work, size_t max_workers, size_t hardware_share) {
+    size_t hardware = std::max<size_t>(std::thread::hardware_concurrency() / hardware_share, 1);
+    size_t by_work = (work + min_work_per_worker - 1) / min_work_per_worker;
+    return std::max<size_t>(std::min({hardware, by_work, max_workers}), 1);
 }
 
-void CombatService::process_convoy_attack() {
-    auto convoy_ships = convoy_repo_.get_alive_ships();
-    auto pirate_ships = pirate_repo_.get_alive_ships();
-    
-    if (convoy_ships.empty() || pirate_ships.empty()) return;
-    
-    for (auto attacker : convoy_ships) {
-        if (!attacker->is_alive()) continue;
-        IShip* target = convoy_strategy_->select_target(attacker, pirate_ships);
-        if (!target) continue;
-        execute_attack(attacker, target);
+std::vector<CombatService::Attacker> CombatService::collect_attackers(const std::vector<IShip*>& ships) {
+    std::vector<Attacker> attackers;
+    attackers.reserve(ships.size());
+    for (auto ship : ships) {
+        if (!ship) continue;
+        DefaultGuard* guard = dynamic_cast<DefaultGuard*>(ship);
+        if (guard) attackers.push_back(Attacker{ship, guard});
     }
+    return attackers;
 }
 
-void CombatService::process_pirate_attack() {
-    auto convoy_ships = convoy_repo_.get_alive_ships();
-    auto pirate_ships = pirate_repo_.get_alive_ships();
-    
-    if (convoy_ships.empty() || pirate_ships.empty()) return;
-    
-    for (auto attacker : pirate_ships) {
-        if (!attacker->is_alive()) continue;
-        IShip* target = pirate_strategy_->select_target(attacker, convoy_ships);
-        if (!target) continue;
+bool CombatService::can_engage(const Attacker& attacker, const SpatialGrid& enemies) {
+    if (!attacker.guard || !attacker.ship->is_alive()) return false;
 
-        double health_before = target->get_health();
-        execute_attack(attacker, target);
-        double health_after = target->get_health();
-
-        CargoInfoVisitor info_visitor;
-        double percent = health_after / health_before;
-        target->accept(&info_visitor);
-        double cargo_for_remove = info_visitor.get_current_cargo() * (1 - percent);
-        mission_.remove_cargo(cargo_for_remove);
-        CargoRemovalVisitor remove_visitor(cargo_for_remove);
-        target->accept(&remove_visitor);
+    double range = attacker.guard->get_loaded_range();
+    if (range <= 0.0) return false;
+    for (IShip* enemy : enemies.query(attacker.ship->get_position(), range)) {
+        if (enemy->is_alive()) return true;
     }
+    return false;
 }
 
 CombatService::CombatService(Mission& mission, ShipRepository& convoy_repo, PirateRepository& pirate_repo, DamageService& damage_service) :
@@ -131,7 +256,9 @@ CombatService::CombatService(Mission& mission, ShipRepository& convoy_repo, Pira
     damage_service_(damage_service),
     strategy_factory_(std::make_unique<AttackStrategyFactoryManager>()),
     convoy_strategy_(strategy_factory_->create_strategy("weakest")),
-    pirate_strategy_(strategy_factory_->create_strategy("random")) {}
+    pirate_strategy_(strategy_factory_->create_strategy("random")),
+    convoy_targeting_(strategy_factory_->create_targeting("weakest", *convoy_strategy_)),
+    pirate_targeting_(strategy_factory_->create_targeting("random", *pirate_strategy_)) {}
 
 CombatService::~CombatService() {
     stop_threads_.store(true);
@@ -141,6 +268,7 @@ bool CombatService::set_convoy_strategy(const std::string& strategy_name) {
     auto strategy = strategy_factory_->create_strategy(strategy_name);
     if (!strategy) return false;
     
+    convoy_targeting_ = strategy_factory_->create_targeting(strategy_name, *strategy);
     convoy_strategy_ = std::move(strategy);
     return true;
 }
@@ -149,6 +277,7 @@ bool CombatService::set_pirate_strategy(const std::string& strategy_name) {
     auto strategy = strategy_factory_->create_strategy(strategy_name);
     if (!strategy) return false;
     
+    pirate_targeting_ = strategy_factory_->create_targeting(strategy_name, *strategy);
     pirate_strategy_ = std::move(strategy);
     return true;
 }
@@ -166,49 +295,139 @@ std::string CombatService::get_current_pirate_strategy() const {
 }
 
 void CombatService::auto_attack_all_sequential() {
+    TRACE_SPAN("combat", "CombatService::auto_attack_all_sequential");
     if (get_convoy_alive_count() == 0 || get_pirates_alive_count() == 0) return;
 
-    process_convoy_attack();
-    process_pirate_attack();
+    auto convoy_ships = get_convoy_ships_safe();
+    auto pirate_ships = get_pirate_ships_safe();
+    if (run_round(collect_attackers(convoy_ships), collect_attackers(pirate_ships), convoy_ships, pirate_ships, false) > 0) mission_.touch();
 }
 
 void CombatService::auto_attack_all_parallel() {
+    TRACE_SPAN("combat", "CombatService::auto_attack_all_parallel");
     if (get_convoy_alive_count() == 0 || get_pirates_alive_count() == 0) return;
 
-    stop_threads_.store(false);
-    
     auto convoy_ships = get_convoy_ships_safe();
     auto pirate_ships = get_pirate_ships_safe();
+    if (run_round(collect_attackers(convoy_ships), collect_attackers(pirate_ships), convoy_ships, pirate_ships, true) > 0) mission_.touch();
+}
 
-    std::vector<std::jthread> threads;
-    
-    size_t convoy_chunk_size = (convoy_ships.size() + 9) / 10;
-    for (size_t i = 0; i < 10; ++i) {
-        size_t start_index = i * convoy_chunk_size;
-        size_t end_index = std::min(start_index + convoy_chunk_size, convoy_ships.size());
+EngagementDTO CombatService::resolve_engagement(bool parallel, size_t max_rounds) {
+    TRACE_SPAN("combat", "CombatService::resolve_engagement");
 
-        if (start_index >= convoy_ships.size()) break;
+    EngagementDTO summary;
+    auto convoy_ships = get_convoy_ships_safe();
+    auto pirate_ships = get_pirate_ships_safe();
+    auto total_health = [&convoy_ships, &pirate_ships]() {
+        double total = 0.0;
+        for (const IShip* ship : convoy_ships) total += ship->get_health();
+        for (const IShip* ship : pirate_ships) total += ship->get_health();
+        return total;
+    };
+    double health_before = total_health();
+    double cargo_before = mission_.get_current_cargo();
+    std::vector<Attacker> convoy_attackers = collect_attackers(convoy_ships);
+    std::vector<Attacker> pirate_attackers = collect_attackers(pirate_ships);
+
+    auto is_dead = [](const IShip* ship) { return !ship->is_alive(); };
+    while (summary.rounds < max_rounds && !convoy_ships.empty() && !pirate_ships.empty()) {
+        SpatialGrid convoy_grid(convoy_ships, engagement_cell_size);
+        SpatialGrid pirate_grid(pirate_ships, engagement_cell_size);
+        std::erase_if(convoy_attackers, [&](const Attacker& attacker) { return !can_engage(attacker, pirate_grid); });
+        std::erase_if(pirate_attackers, [&](const Attacker& attacker) { return !can_engage(attacker, convoy_grid); });
+
+        if (convoy_attackers.empty() && pirate_attackers.empty()) {
+            summary.stalemate = true;
+            break;
+        }
 
-        threads.emplace_back(
-            [this, start_index, end_index, &convoy_ships, &pirate_ships](){
-                this->process_convoy_attack_range(start_index, end_index, convoy_ships, pirate_ships);
-            }
-        );
+        summary.shots += run_round(convoy_attackers, pirate_attackers, convoy_ships, pirate_ships, parallel);
+        ++summary.rounds;
+
+        std::erase_if(convoy_ships, is_dead);
+        std::erase_if(pirate_ships, is_dead);
+        TRACE_COUNTER("combat", "convoy_alive", convoy_ships.size());
+        TRACE_COUNTER("combat", "pirates_alive", pirate_ships.size());
     }
 
-    size_t pirate_chunk_size = (pirate_ships.size() + 9) / 10;
-    for (size_t i = 0; i < 10; ++i) {
-        size_t start_index = i * pirate_chunk_size;
-        size_t end_index = std::min(start_index + pirate_chunk_size, pirate_ships.size());
+    summary.damage_dealt = health_before - total_health();
+    summary.cargo_lost = cargo_before - mission_.get_current_cargo();
+    summary.convoy_alive = convoy_ships.size();
+    summary.pirates_alive = pirate_ships.size();
+    if (summary.shots > 0) mission_.touch();
+    return summary;
+}
+
+size_t CombatService::auto_attack_timed(double duration) {
+    TRACE_SPAN("combat", "CombatService::auto_attack_timed");
+    if (duration <= 0.0) throw std::invalid_argument("Combat duration must be positive");
+    if (get_convoy_alive_count() == 0 || get_pirates_alive_count() == 0) return 0;
 
-        if (start_index >= pirate_ships.size()) break;
+    stop_threads_.store(false);
 
-        threads.emplace_back(
-            [this, start_index, end_index, &convoy_ships, &pirate_ships](){
-                this->process_pirate_attack_range(start_index, end_index, convoy_ships, pirate_ships);
+    auto convoy_ships = get_convoy_ships_safe();
+    auto pirate_ships = get_pirate_ships_safe();
+    TargetBoard convoy_targets(convoy_ships);
+    TargetBoard pirate_targets(pirate_ships);
+
+    CombatEventQueue queue;
+    schedule_weapons(convoy_ships, CombatSide::convoy, queue);
+    schedule_weapons(pirate_ships, CombatSide::pirates, queue);
+
+    std::vector<CombatEvent> batch;
+    size_t shots = 0;
+    while (!queue.empty() && convoy_targets.alive_count() > 0 && pirate_targets.alive_count() > 0) {
+        if (stop_threads_.load()) break;
+        queue.pop_batch(batch);
+
+        if (batch.size() < parallel_batch_threshold) {
+            for (const auto& event : batch) {
+                auto next = resolve_event(event, duration, convoy_targets, pirate_targets, telemetry_.slot(0), shots);
+                if (next.has_value()) queue.push(next.value());
             }
-        );
+            continue;
+        }
+
+        // Выстрелы одного корабля попадают в один поток: оружие корабля делит общий профиль
+        std::stable_sort(batch.begin(), batch.end(), [](const CombatEvent& a, const CombatEvent& b) {
+            return std::less<const IShip*>()(a.attacker, b.attacker);
+        });
+
+        size_t workers = worker_count(batch.size(), CombatTelemetry::worker_slot_count, 1);
+        std::vector<std::vector<CombatEvent>> rescheduled(workers);
+        std::vector<size_t> worker_shots(workers, 0);
+        {
+            std::vector<std::jthread> threads;
+            size_t chunk_size = (batch.size() + workers - 1) / workers;
+            size_t end_index = 0;
+            for (size_t i = 0; i < workers; ++i) {
+                size_t start_index = end_index;
+                end_index = std::min(start_index + chunk_size, batch.size());
+                while (end_index < batch.size() && batch[end_index].attacker == batch[end_index - 1].attacker) ++end_index;
+
+                if (start_index >= batch.size()) break;
+
+                TelemetrySlot& stats = telemetry_.worker_slot(i);
+                threads.emplace_back(
+                    [this, start_index, end_index, duration, &batch, &rescheduled, &worker_shots, i, &convoy_targets, &pirate_targets, &stats](){
+                        size_t fired = 0;
+                        for (size_t j = start_index; j < end_index; ++j) {
+                            auto next = this->resolve_event(batch[j], duration, convoy_targets, pirate_targets, stats, fired);
+                            if (next.has_value()) rescheduled[i].push_back(next.value());
+                        }
+                        worker_shots[i] = fired;
+                    }
+                );
+            }
+        }
+        for (const auto& events : rescheduled) {
+            for (const auto& event : events) queue.push(event);
+        }
+        shots = std::accumulate(worker_shots.begin(), worker_shots.end(), shots);
     }
+    telemetry_.end_round();
+    if (shots > 0) mission_.touch();
+    return shots;
 }
 
 size_t CombatService::get_convoy_alive_count() const {
@@ -224,13 +443,11 @@ size_t CombatService::get_pirate_bases_count() const {
 }
 
 bool CombatService::is_base_activated(size_t index) const {
-    PirateBase pirate_base = mission_.get_pirate_base(index);
-    return pirate_base.is_activated;
+    return mission_.get_pirate_base(index).is_activated;
 }
 
 bool CombatService::is_base_defeated(size_t index) const {
-    PirateBase pirate_base = mission_.get_pirate_base(index);
-    return pirate_base.is_defeated;
+    return mission_.get_pirate_base(index).is_defeated;
 }
 
 std::vector<IShip*> CombatService::get_all_ship_ptrs() const {
@@ -247,4 +464,24 @@ std::vector<IShip*> CombatService::get_attack_ships() const {
 
 std::vector<IShip*> CombatService::get_all_pirate_ship_ptrs() const {
     return pirate_repo_.get_all_ship_ptrs();
+}
+
+const std::deque<CombatRoundDTO>& CombatService::get_combat_rounds() const {
+    return telemetry_.get_rounds();
+}
+
+CombatRoundDTO CombatService::get_combat_totals() const {
+    return telemetry_.get_totals();
+}
+
+void CombatService::write_combat_csv(std::ostream& out) const {
+    telemetry_.write_csv(out);
+}
+
+void CombatService::clear_combat_telemetry() {
+    telemetry_.clear();
+}
+
+void CombatService::set_combat_telemetry_enabled(bool enabled) {
+    telemetry_.set_enabled(enabled);
 }
\ No newline at end of file
@@ -9,7 +9,13 @@
 #include "../../repository/ShipRepository.hpp"
 #include "../../repository/PirateRepository.hpp"
 #include "../../service/combat/DamageService.hpp"
+#include "../../service/combat/CombatEventQueue.hpp"
+#include "../../service/combat/HitResolver.hpp"
+#include "../../service/combat/CombatTelemetry.hpp"
+#include "../../DTO/EngagementDTO.hpp"
 #include "../../service/combat/strategy/IAttackStrategy.hpp"
+#include "../../service/combat/strategy/TargetBoard.hpp"
+#include "../../service/combat/strategy/TargetingPolicy.hpp"
 #include "factories/AttackStrategyFactoryManager.hpp"
 
 #include <thread>
@@ -29,32 +35,128 @@ class CombatService {
         std::unique_ptr<AttackStrategyFactoryManager> strategy_factory_; ///< Менеджер фабрик стратегий
         std::unique_ptr<IAttackStrategy> convoy_strategy_; ///< Стратегия конвоя
         std::unique_ptr<IAttackStrategy> pirate_strategy_; ///< Стратегия пиратов
+        TargetingPolicy convoy_targeting_; ///< Политика выбора цели и оружия конвоя
+        TargetingPolicy pirate_targeting_; ///< Политика выбора цели и оружия пиратов
+
+        static constexpr size_t parallel_batch_threshold = 64; ///< Минимальный размер пачки событий для параллельной обработки
+        static constexpr size_t min_work_per_worker = 16; ///< Наименьшее количество атакующих или событий на один рабочий поток
+
+        static constexpr double engagement_cell_size = 8.0; ///< Размер ячейки сетки для проверки целей в пределах дальности (порядка дальности оружия в каталоге)
 
-        mutable std::mutex mission_mutex_; ///< Мьютекс для доступа к данным миссии
         std::atomic<bool> stop_threads_{false}; ///< Флаг остановки потоков
+        CombatTelemetry telemetry_; ///< Статистика боя по раундам
+
+        /**
+         * @struct Attacker
+         * @brief Атакующий корабль и его вооружение, определенное один раз при составлении списка атакующих
+         */
+        struct Attacker {
+            IShip* ship = nullptr; ///< Атакующий корабль
+            DefaultGuard* guard = nullptr; ///< Вооружение атакующего корабля
+        };
 
         std::vector<IShip*> get_convoy_ships_safe() const;
         std::vector<IShip*> get_pirate_ships_safe() const;
-        void process_convoy_attack_range(size_t start, size_t end, const std::vector<IShip*>& convoy_ships, const std::vector<IShip*>& pirate_ships);
-        void process_pirate_attack_range(size_t start, size_t end, const std::vector<IShip*>& convoy_ships, const std::vector<IShip*>& pirate_ships);
+        size_t process_convoy_attack_range(size_t start, size_t end, const std::vector<Attacker>& convoy_ships, TargetBoard& pirate_targets, TelemetrySlot& stats);
+        size_t process_pirate_attack_range(size_t start, size_t end, const std::vector<Attacker>& pirate_ships, TargetBoard& convoy_targets, TelemetrySlot& stats);
+
+        /**
+         * @brief Вычисляет количество рабочих потоков для заданного объема работы
+         * @details Потоков не больше, чем аппаратных потоков, чем слотов статистики (max_workers)
+         * и чем нужно, чтобы на каждый пришлось хотя бы min_work_per_worker единиц работы
+         * @param work Количество единиц работы (атакующих или событий)
+         * @param max_workers Наибольшее количество потоков
+         * @param hardware_share Доля аппаратных потоков (количество групп потоков, работающих одновременно)
+         * @return size_t Количество потоков (не меньше одного)
+         */
+        static size_t worker_count(size_t work, size_t max_workers, size_t hardware_share);
+
+        /**
+         * @brief Составляет список атакующих из вооруженных кораблей
+         * @param ships Корабли
+         * @return std::vector<Attacker> Вооруженные корабли вместе с их вооружением (невооруженные пропускаются)
+         */
+        static std::vector<Attacker> collect_attackers(const std::vector<IShip*>& ships);
+
+        /**
+         * @brief Выполняет выстрел из заданного оружия, включая урон от взрыва по соседним целям
+         * @param guard Вооружение атакующего корабля
+         * @param place Место оружия
+         * @param target Целевой корабль
+         * @param distance Расстояние до цели
+         * @param targets Цели раунда (обновляются после урона)
+         * @param side Сторона атакующего корабля (груз списывается с поврежденных кораблей конвоя)
+         * @param stats Счетчики боя текущего потока (не изменяются при отключенной статистике)
+         * @return bool true если выстрел выполнен, false в противном случае
+         */
+        bool resolve_shot(DefaultGuard& guard, PlaceForWeapon place, IShip* target, double distance, TargetBoard& targets, CombatSide side, TelemetrySlot& stats);
 
         /**
-         * @brief Выполняет атаку одного корабля по другому
-         * @param attacker Атакующий корабль
+         * @brief Выполняет атаку одного корабля по другому, включая урон от взрыва по соседним целям
+         * @param targeting Политика выбора оружия
+         * @param attacker Атакующий корабль и его вооружение
          * @param target Целевой корабль
+         * @param targets Цели раунда (обновляются после урона)
+         * @param side Сторона атакующего корабля
+         * @param stats Счетчики боя текущего потока
          * @return bool true если атака успешна, false в противном случае
          */
-        bool execute_attack(IShip* attacker, IShip* target);
+        template <typename Targeting>
+        bool strike(const Targeting& targeting, const Attacker& attacker, IShip* target, TargetBoard& targets, CombatSide side, TelemetrySlot& stats);
+        template <typename Targeting>
+        size_t convoy_attack_range(const Targeting& targeting, size_t start, size_t end, const std::vector<Attacker>& convoy_ships, TargetBoard& pirate_targets, TelemetrySlot& stats);
+        template <typename Targeting>
+        size_t pirate_attack_range(const Targeting& targeting, size_t start, size_t end, const std::vector<Attacker>& pirate_ships, TargetBoard& convoy_targets, TelemetrySlot& stats);
 
         /**
-         * @brief Обрабатывает атаки конвоя
+         * @brief Выполняет запланированный выстрел по цели, выбранной политикой стороны
+         * @param targeting Политика выбора цели
+         * @param event Событие выстрела
+         * @param targets Цели противника
+         * @param stats Счетчики боя текущего потока
+         * @return bool true если выстрел выполнен, false в противном случае
          */
-        void process_convoy_attack();
-        
+        template <typename Targeting>
+        bool fire_event(const Targeting& targeting, const CombatEvent& event, TargetBoard& targets, TelemetrySlot& stats);
+
+        /**
+         * @brief Планирует первый выстрел каждого заряженного оружия кораблей
+         * @param ships Корабли
+         * @param side Сторона кораблей
+         * @param queue Очередь событий
+         */
+        void schedule_weapons(const std::vector<IShip*>& ships, CombatSide side, CombatEventQueue& queue) const;
+
+        /**
+         * @brief Обрабатывает событие выстрела и планирует следующий выстрел того же оружия
+         * @param event Событие выстрела
+         * @param duration Продолжительность боя
+         * @param convoy_targets Цели конвоя
+         * @param pirate_targets Цели пиратов
+         * @param stats Счетчики боя текущего потока
+         * @param shots Количество выполненных выстрелов (увеличивается, если выстрел выполнен)
+         * @return std::optional<CombatEvent> Следующее событие или std::nullopt, если оружие больше не стреляет в пределах duration
+         */
+        std::optional<CombatEvent> resolve_event(const CombatEvent& event, double duration, TargetBoard& convoy_targets, TargetBoard& pirate_targets, TelemetrySlot& stats, size_t& shots);
+
         /**
-         * @brief Обрабатывает атаки пиратов
+         * @brief Проводит один раунд боя и записывает его статистику, если она включена
+         * @param convoy_attackers Атакующие корабли конвоя
+         * @param pirate_attackers Атакующие пиратские корабли
+         * @param convoy_ships Живые корабли конвоя (цели пиратов)
+         * @param pirate_ships Живые пиратские корабли (цели конвоя)
+         * @param parallel Выполнять ли атаки сторон параллельно
+         * @return size_t Количество выполненных выстрелов
          */
-        void process_pirate_attack();
+        size_t run_round(const std::vector<Attacker>& convoy_attackers, const std::vector<Attacker>& pirate_attackers, const std::vector<IShip*>& convoy_ships, const std::vector<IShip*>& pirate_ships, bool parallel);
+
+        /**
+         * @brief Проверяет, может ли корабль выстрелить хотя бы по одной цели
+         * @param attacker Атакующий корабль и его вооружение
+         * @param enemies Пространственная сетка кораблей противника
+         * @return bool true если у корабля есть заряженное оружие и живая цель в пределах его дальности, false в противном случае
+         */
+        static bool can_engage(const Attacker& attacker, const SpatialGrid& enemies);
     public:
         /**
          * @brief Конструктор
@@ -109,6 +211,26 @@ class CombatService {
          */
         void auto_attack_all_parallel();
         
+        /**
+         * @brief Проводит бой до уничтожения одной из сторон или до тупика
+         * @details Списки атакующих хранятся между раундами и только сокращаются: из них убираются потопленные корабли
+         * и корабли без боезапаса. Бой останавливается, если ни у одного корабля нет живой цели в пределах дальности заряженного оружия.
+         * @param parallel Выполнять ли атаки сторон параллельно
+         * @param max_rounds Максимальное количество раундов
+         * @return EngagementDTO Итоги боя
+         */
+        EngagementDTO resolve_engagement(bool parallel = false, size_t max_rounds = 100000);
+
+        /**
+         * @brief Выполняет бой с учетом скорострельности оружия
+         * @details Каждое оружие стреляет в моменты shot / fire_rate, начиная с нуля. Выстрелы упорядочены очередью событий,
+         * одновременные выстрелы обрабатываются одной пачкой (параллельно, если пачка большая).
+         * @param duration Продолжительность боя в модельном времени
+         * @return size_t Количество выполненных выстрелов
+         * @throws std::invalid_argument Если продолжительность не положительна
+         */
+        size_t auto_attack_timed(double duration);
+
         /**
          * @brief Получает количество живых кораблей конвоя
          * @return size_t Количество живых кораблей конвоя
@@ -165,4 +287,37 @@ class CombatService {
          * @return std::vector<IShip*> Вектор указателей на все пиратские корабли
          */
         std::vector<IShip*> get_all_pirate_ship_ptrs() const;
+
+        /**
+         * @brief Получает статистику завершенных раундов боя
+         * @details auto_attack_all_* и каждый раунд resolve_engagement добавляют одну запись, auto_attack_timed — одну запись на весь бой.
+         * Хранятся только последние CombatTelemetry::default_history_limit записей
+         * @return const std::deque<CombatRoundDTO>& Записи раундов от старых к новым
+         */
+        const std::deque<CombatRoundDTO>& get_combat_rounds() const;
+
+        /**
+         * @brief Получает суммарную статистику всех записанных раундов
+         * @return CombatRoundDTO Сумма по раундам (поле round равно количеству раундов)
+         */
+        CombatRoundDTO get_combat_totals() const;
+
+        /**
+         * @brief Выгружает статистику раундов в CSV
+         * @param out Поток вывода
+         */
+        void write_combat_csv(std::ostream& out) const;
+
+        /**
+         * @brief Удаляет статистику раундов
+         */
+        void clear_combat_telemetry();
+
+        /**
+         * @brief Включает или отключает подробную статистику боя
+         * @details При отключенной статистике выстрелы не записываются в счетчики потоков и записи раундов не ведутся,
+         * итоги resolve_engagement и auto_attack_timed считаются без нее
+         * @param enabled true - вести статистику, false - не вести
+         */
+        void set_combat_telemetry_enabled(bool enabled);
 };
\ No newline at end of file
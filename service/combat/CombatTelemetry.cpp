@@ -0,0 +1,142 @@
+#include "CombatTelemetry.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+void TelemetrySlot::record_shot(const std::string& weapon_type, const HitResult& hit, CombatSide side) {
+    ++shots;
+    if (hit.hit) ++hits;
+    else ++misses;
+    if (hit.critical) ++criticals;
+    record_splash(hit, side);
+
+    for (auto& [type, count] : ammo_used) {
+        if (type == weapon_type) {
+            ++count;
+            return;
+        }
+    }
+    ammo_used.emplace_back(weapon_type, 1);
+}
+
+void TelemetrySlot::record_splash(const HitResult& hit, CombatSide side) {
+    if (hit.killed) ++kills;
+    if (hit.damage > hit.health_lost) overkill += hit.damage - hit.health_lost;
+    if (side == CombatSide::convoy) convoy_damage += hit.health_lost;
+    else pirate_damage += hit.health_lost;
+    cargo_lost += hit.cargo_lost;
+}
+
+void TelemetrySlot::clear() {
+    shots = hits = misses = criticals = kills = 0;
+    overkill = convoy_damage = pirate_damage = cargo_lost = 0.0;
+    ammo_used.clear();
+}
+
+void CombatTelemetry::add_ammo(std::vector<std::pair<std::string, size_t>>& ammo_used, const std::string& type, size_t count) {
+    auto it = std::find_if(ammo_used.begin(), ammo_used.end(), [&type](const auto& entry) { return entry.first == type; });
+    if (it != ammo_used.end()) it->second += count;
+    else ammo_used.emplace_back(type, count);
+}
+
+CombatTelemetry::CombatTelemetry(size_t history_limit) : slots_(slot_count), history_limit_(history_limit) {
+    if (history_limit_ == 0) throw std::invalid_argument("Telemetry history limit must be positive");
+}
+
+TelemetrySlot& CombatTelemetry::slot(size_t index) {
+    if (index >= slots_.size()) throw std::out_of_range("Telemetry slot index out of range");
+    return slots_[index];
+}
+
+TelemetrySlot& CombatTelemetry::worker_slot(size_t worker) {
+    if (worker >= worker_slot_count) throw std::out_of_range("Telemetry worker index out of range");
+    return slots_[1 + worker];
+}
+
+void CombatTelemetry::set_enabled(bool enabled) {
+    enabled_ = enabled;
+    for (auto& slot : slots_) slot.clear();
+}
+
+bool CombatTelemetry::is_enabled() const {
+    return enabled_;
+}
+
+CombatRoundDTO CombatTelemetry::end_round() {
+    CombatRoundDTO round;
+    if (!enabled_) return round;
+
+    round.round = ++total_rounds_;
+    for (auto& slot : slots_) {
+        round.shots += slot.shots;
+        round.hits += slot.hits;
+        round.misses += slot.misses;
+        round.criticals += slot.criticals;
+        round.kills += slot.kills;
+        round.overkill += slot.overkill;
+        round.convoy_damage += slot.convoy_damage;
+        round.pirate_damage += slot.pirate_damage;
+        round.cargo_lost += slot.cargo_lost;
+        for (const auto& [type, count] : slot.ammo_used) add_ammo(round.ammo_used, type, count);
+        slot.clear();
+    }
+
+    std::sort(round.ammo_used.begin(), round.ammo_used.end());
+    if (rounds_.size() == history_limit_) rounds_.pop_front();
+    rounds_.push_back(round);
+    return round;
+}
+
+const std::deque<CombatRoundDTO>& CombatTelemetry::get_rounds() const {
+    return rounds_;
+}
+
+void CombatTelemetry::accumulate(CombatRoundDTO& totals, const CombatRoundDTO& round) {
+    ++totals.round;
+    totals.shots += round.shots;
+    totals.hits += round.hits;
+    totals.misses += round.misses;
+    totals.criticals += round.criticals;
+    totals.kills += round.kills;
+    totals.overkill += round.overkill;
+    totals.convoy_damage += round.convoy_damage;
+    totals.pirate_damage += round.pirate_damage;
+    totals.cargo_lost += round.cargo_lost;
+    for (const auto& [type, count] : round.ammo_used) add_ammo(totals.ammo_used, type, count);
+}
+
+CombatRoundDTO CombatTelemetry::get_totals() const {
+    CombatRoundDTO totals;
+    for (const auto& round : rounds_) accumulate(totals, round);
+    std::sort(totals.ammo_used.begin(), totals.ammo_used.end());
+    return totals;
+}
+
+void CombatTelemetry::clear() {
+    rounds_.clear();
+    total_rounds_ = 0;
+    for (auto& slot : slots_) slot.clear();
+}
+
+void CombatTelemetry::write_csv(std::ostream& out) const {
+    std::vector<std::string> types;
+    for (const auto& round : rounds_) {
+        for (const auto& [type, count] : round.ammo_used) {
+            if (std::find(types.begin(), types.end(), type) == types.end()) types.push_back(type);
+        }
+    }
+    std::sort(types.begin(), types.end());
+
+    out << "round,shots,hits,misses,criticals,kills,overkill,convoy_damage,pirate_damage,cargo_lost";
+    for (const auto& type : types) out << ",ammo_" << type;
+    out << '\n';
+
+    for (const auto& round : rounds_) {
+        out << round.round << ',' << round.shots << ',' << round.hits << ',' << round.misses << ',' << round.criticals << ','
+            << round.kills << ',' << round.overkill << ',' << round.convoy_damage << ',' << round.pirate_damage << ',' << round.cargo_lost;
+        for (const auto& type : types) {
+            auto it = std::find_if(round.ammo_used.begin(), round.ammo_used.end(), [&type](const auto& entry) { return entry.first == type; });
+            out << ',' << (it != round.ammo_used.end() ? it->second : 0);
+        }
+        out << '\n';
+    }
+}
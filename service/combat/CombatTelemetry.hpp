@@ -0,0 +1,156 @@
+/**
+ * @file CombatTelemetry.hpp
+ * @brief Заголовочный файл, содержащий определение класса CombatTelemetry
+ */
+
+#pragma once
+
+#include "HitResolver.hpp"
+#include "CombatEventQueue.hpp"
+#include "../../DTO/CombatRoundDTO.hpp"
+#include <ostream>
+#include <string>
+#include <vector>
+#include <deque>
+
+/**
+ * @struct TelemetrySlot
+ * @brief Счетчики боя одного потока
+ * @details Каждый поток раунда пишет только в свой слот, слоты выровнены по кэш-линии,
+ * поэтому счетчики обновляются обычными операциями без блокировок и ложного разделения.
+ */
+struct alignas(64) TelemetrySlot {
+    size_t shots = 0; ///< Количество выстрелов
+    size_t hits = 0; ///< Количество попаданий
+    size_t misses = 0; ///< Количество промахов
+    size_t criticals = 0; ///< Количество критических попаданий
+    size_t kills = 0; ///< Количество потопленных кораблей
+    double overkill = 0.0; ///< Урон сверх оставшегося здоровья целей
+    double convoy_damage = 0.0; ///< Урон, нанесенный конвоем
+    double pirate_damage = 0.0; ///< Урон, нанесенный пиратами
+    double cargo_lost = 0.0; ///< Потерянный конвоем груз
+    std::vector<std::pair<std::string, size_t>> ammo_used; ///< Израсходованные снаряды по типам оружия
+
+    /**
+     * @brief Учитывает выстрел
+     * @param weapon_type Тип оружия
+     * @param hit Итог выстрела
+     * @param side Сторона атакующего корабля
+     */
+    void record_shot(const std::string& weapon_type, const HitResult& hit, CombatSide side);
+
+    /**
+     * @brief Учитывает урон от взрыва по соседнему кораблю
+     * @param hit Итог попадания
+     * @param side Сторона атакующего корабля
+     */
+    void record_splash(const HitResult& hit, CombatSide side);
+
+    /**
+     * @brief Обнуляет счетчики
+     */
+    void clear();
+};
+
+/**
+ * @class CombatTelemetry
+ * @brief Статистика боя по раундам
+ * @details Во время раунда потоки пишут в собственные TelemetrySlot, по окончании раунда
+ * end_round() сводит слоты в одну запись CombatRoundDTO и обнуляет их.
+ * История хранит не больше history_limit последних раундов, более старые вытесняются.
+ * Статистику можно отключить: тогда вызывающий код не пишет в слоты, а end_round() не сводит их и не сохраняет записи.
+ */
+class CombatTelemetry {
+    private:
+        std::vector<TelemetrySlot> slots_; ///< Слоты потоков
+        std::deque<CombatRoundDTO> rounds_; ///< Записи последних завершенных раундов
+        size_t history_limit_; ///< Наибольшее количество хранимых записей раундов
+        size_t total_rounds_ = 0; ///< Количество раундов, завершенных с последней очистки
+        bool enabled_ = true; ///< Включена ли статистика
+
+        /**
+         * @brief Прибавляет расход снарядов одного типа к списку
+         * @param ammo_used Список расхода по типам оружия
+         * @param type Тип оружия
+         * @param count Количество снарядов
+         */
+        static void add_ammo(std::vector<std::pair<std::string, size_t>>& ammo_used, const std::string& type, size_t count);
+    public:
+        static constexpr size_t max_workers_per_side = 10; ///< Наибольшее количество рабочих потоков одной стороны в раунде
+        static constexpr size_t worker_slot_count = 2 * max_workers_per_side; ///< Количество слотов рабочих потоков (обе стороны раунда)
+        static constexpr size_t slot_count = 1 + worker_slot_count; ///< Количество слотов: вызывающий поток и рабочие потоки
+        static constexpr size_t default_history_limit = 4096; ///< Количество хранимых записей раундов по умолчанию
+
+        /**
+         * @brief Конструктор
+         * @param history_limit Наибольшее количество хранимых записей раундов
+         * @throws std::invalid_argument Если history_limit равен нулю
+         */
+        explicit CombatTelemetry(size_t history_limit = default_history_limit);
+
+        /**
+         * @brief Получает слот потока
+         * @param index Индекс слота (0 - вызывающий поток)
+         * @return TelemetrySlot& Ссылка на слот
+         * @throws std::out_of_range Если индекс не меньше slot_count
+         */
+        TelemetrySlot& slot(size_t index);
+
+        /**
+         * @brief Получает слот рабочего потока
+         * @param worker Номер рабочего потока (потоки пиратов раунда нумеруются с max_workers_per_side)
+         * @return TelemetrySlot& Ссылка на слот
+         * @throws std::out_of_range Если номер не меньше worker_slot_count
+         */
+        TelemetrySlot& worker_slot(size_t worker);
+
+        /**
+         * @brief Включает или отключает статистику
+         * @details Слоты обнуляются, поэтому после повторного включения в записи не попадают выстрелы, сделанные до отключения
+         * @param enabled true - вести статистику, false - не вести
+         */
+        void set_enabled(bool enabled);
+
+        /**
+         * @brief Проверяет, включена ли статистика
+         * @return bool true если включена, false в противном случае
+         */
+        bool is_enabled() const;
+
+        /**
+         * @brief Завершает раунд: сводит слоты в итог раунда и обнуляет их
+         * @details Вызывается, когда рабочие потоки раунда завершены
+         * @return CombatRoundDTO Итог раунда (пустой, если статистика отключена)
+         */
+        CombatRoundDTO end_round();
+
+        /**
+         * @brief Получает записи последних завершенных раундов
+         * @return const std::deque<CombatRoundDTO>& Записи раундов от старых к новым
+         */
+        const std::deque<CombatRoundDTO>& get_rounds() const;
+
+        /**
+         * @brief Суммирует хранимые записи раундов
+         * @return CombatRoundDTO Сумма (поле round равно количеству просуммированных раундов)
+         */
+        CombatRoundDTO get_totals() const;
+
+        /**
+         * @brief Прибавляет итог раунда к сумме
+         * @param totals Сумма (поле round увеличивается на единицу)
+         * @param round Итог раунда
+         */
+        static void accumulate(CombatRoundDTO& totals, const CombatRoundDTO& round);
+
+        /**
+         * @brief Удаляет записи раундов и обнуляет слоты
+         */
+        void clear();
+
+        /**
+         * @brief Выгружает записи раундов в CSV (по строке на раунд, по столбцу ammo_<тип> на каждый тип оружия)
+         * @param out Поток вывода
+         */
+        void write_csv(std::ostream& out) const;
+};
@@ -1,4 +1,5 @@
 #include "DamageService.hpp"
+#include "../../auxiliary/Tracer.hpp"
 #include <chrono>
 
 thread_local std::mt19937 local_rng(std::chrono::steady_clock::now().time_since_epoch().count());
@@ -8,18 +9,26 @@ double DamageService::get_random_double(double min, double max) {
 }
 
 double DamageService::calculate_damage(const IWeapon* weapon, const IShip* target, double distance) {
-    if (!weapon || !target || !target->is_alive()) return 0.0;
-    if (distance > weapon->get_range()) return 0.0;
-    if (!check_hit(weapon->get_accuracy(), distance, weapon->get_range())) return 0.0;
+    return roll_damage(weapon, target, distance).damage;
+}
+
+DamageRoll DamageService::roll_damage(const IWeapon* weapon, const IShip* target, double distance) {
+    TRACE_SPAN("damage", "DamageService::roll_damage");
+    DamageRoll roll;
+    if (!weapon || !target || !target->is_alive()) return roll;
+    if (distance > weapon->get_range()) return roll;
+    if (!check_hit(weapon->get_accuracy(), distance, weapon->get_range())) return roll;
+    roll.hit = true;
     
     double base_damage = weapon->get_damage();
     double final_damage = calculate_effective_damage(base_damage, distance, weapon->get_range());
 
-    if (is_critical_hit()) final_damage *= 1.5;
+    roll.critical = is_critical_hit();
+    if (roll.critical) final_damage *= 1.5;
 
-    final_damage = std::round(final_damage * 10.0) / 10.0;
+    roll.damage = std::round(final_damage * 10.0) / 10.0;
 
-    return final_damage;
+    return roll;
 }
 
 bool DamageService::check_hit(double base_accuracy, double distance, double max_range) {
@@ -45,4 +54,10 @@ bool DamageService::is_critical_hit(double critical_chance) {
     if (critical_chance <= 0) return false;
     if (critical_chance >= 1.0) return true;
     return critical_chance >= get_random_double(0.0, 1.0);
+}
+
+double DamageService::calculate_splash_damage(double impact_damage, double distance, double explosion_radius) const {
+    if (impact_damage <= 0.0 || explosion_radius <= 0.0 || distance >= explosion_radius) return 0.0;
+    double falloff = 1.0 - std::max(0.0, distance) / explosion_radius;
+    return std::round(impact_damage * falloff * 10.0) / 10.0;
 }
\ No newline at end of file
@@ -9,6 +9,16 @@
 #include "../../entity/ship/Interfaces/IShip.hpp"
 #include <random>
 
+/**
+ * @struct DamageRoll
+ * @brief Результат броска урона по цели
+ */
+struct DamageRoll {
+    double damage = 0.0; ///< Вычисленный урон (0.0 при промахе)
+    bool hit = false; ///< Флаг попадания
+    bool critical = false; ///< Флаг критического попадания
+};
+
 /**
  * @class DamageService
  * @brief Сервис для расчета урона в бою
@@ -39,6 +49,15 @@ class DamageService {
          * @return double Вычисленный урон
          */
         double calculate_damage(const IWeapon* weapon, const IShip* target, double distance);
+
+        /**
+         * @brief Бросает урон от оружия по цели, сообщая о попадании и критическом ударе
+         * @param weapon Указатель на оружие
+         * @param target Указатель на цель
+         * @param distance Расстояние до цели
+         * @return DamageRoll Результат броска
+         */
+        DamageRoll roll_damage(const IWeapon* weapon, const IShip* target, double distance);
         
         /**
          * @brief Проверяет попадание по цели
@@ -64,4 +83,14 @@ class DamageService {
          * @return bool true если критическое попадание, false в противном случае
          */
         bool is_critical_hit(double critical_chance = 0.1);
+
+        /**
+         * @brief Вычисляет урон от взрыва по кораблю рядом с точкой попадания
+         * @details Урон линейно убывает от урона по основной цели в центре взрыва до нуля на границе радиуса
+         * @param impact_damage Урон по основной цели
+         * @param distance Расстояние от точки попадания до корабля
+         * @param explosion_radius Радиус взрыва
+         * @return double Урон от взрыва
+         */
+        double calculate_splash_damage(double impact_damage, double distance, double explosion_radius) const;
 };
\ No newline at end of file
@@ -0,0 +1,44 @@
+#include "HitResolver.hpp"
+#include "../../entity/ship/Abstracts/DefaultCargo.hpp"
+
+HitResult HitResolver::resolve(DefaultGuard& attacker, PlaceForWeapon place, IShip* target, double distance, DamageService& damage_service, bool lose_cargo) {
+    HitResult result;
+    const IWeapon* weapon = attacker.get_weapon_in_place(place);
+    if (!weapon || !target) return result;
+    size_t current_ammo = weapon->get_current_ammo();
+    if (current_ammo == 0 || distance > weapon->get_range()) return result;
+
+    DamageRoll roll = damage_service.roll_damage(weapon, target, distance);
+    attacker.consume_ammo(place);
+
+    if (roll.hit) result = apply_damage(target, roll.damage, lose_cargo);
+    result.fired = true;
+    result.hit = roll.hit;
+    result.critical = roll.critical;
+    result.damage = roll.damage;
+    return result;
+}
+
+HitResult HitResolver::apply_damage(IShip* target, double damage, bool lose_cargo) {
+    HitResult result;
+    result.damage = damage;
+    if (!target || damage <= 0.0) return result;
+
+    bool was_alive = target->is_alive();
+    double health_before = target->get_health();
+    target->take_damage(damage);
+    double health_after = target->get_health();
+    result.health_lost = health_before - health_after;
+    result.killed = was_alive && !target->is_alive();
+
+    if (!lose_cargo || health_before <= 0.0 || result.health_lost <= 0.0) return result;
+    DefaultCargo* cargo = dynamic_cast<DefaultCargo*>(target);
+    if (!cargo) return result;
+
+    double cargo_to_remove = cargo->get_cargo() * (result.health_lost / health_before);
+    if (cargo_to_remove > 0.0) {
+        cargo->remove_cargo(cargo_to_remove);
+        result.cargo_lost = cargo_to_remove;
+    }
+    return result;
+}
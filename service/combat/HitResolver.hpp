@@ -0,0 +1,55 @@
+/**
+ * @file HitResolver.hpp
+ * @brief Заголовочный файл, содержащий определение класса HitResolver
+ */
+
+#pragma once
+
+#include "DamageService.hpp"
+#include "../../auxiliary/PlaceForWeapon.hpp"
+#include "../../entity/ship/Abstracts/DefaultGuard.hpp"
+
+/**
+ * @struct HitResult
+ * @brief Итог одного выстрела
+ */
+struct HitResult {
+    double damage = 0.0; ///< Урон, выпавший при выстреле (0.0 при промахе)
+    double health_lost = 0.0; ///< Здоровье, фактически потерянное целью
+    double cargo_lost = 0.0; ///< Груз, потерянный целью
+    bool fired = false; ///< Флаг выполненного выстрела
+    bool hit = false; ///< Флаг попадания
+    bool critical = false; ///< Флаг критического попадания
+    bool killed = false; ///< Флаг потопления цели этим выстрелом
+};
+
+/**
+ * @class HitResolver
+ * @brief Выполняет выстрел целиком за один вызов
+ * @details Проверка боезапаса и дальности, бросок урона, расход снаряда, гибель цели и списание груза
+ * выполняются вместе, без посетителей ShootingVisitor, CargoInfoVisitor и CargoRemovalVisitor.
+ */
+class HitResolver {
+    public:
+        /**
+         * @brief Выполняет выстрел из оружия на заданном месте по цели
+         * @details Живость атакующего не проверяется. Груз списывается пропорционально потерянному здоровью
+         * @param attacker Вооружение атакующего корабля
+         * @param place Место оружия
+         * @param target Целевой корабль
+         * @param distance Расстояние до цели
+         * @param damage_service Сервис урона
+         * @param lose_cargo Списывать ли груз цели
+         * @return HitResult Итог выстрела
+         */
+        static HitResult resolve(DefaultGuard& attacker, PlaceForWeapon place, IShip* target, double distance, DamageService& damage_service, bool lose_cargo);
+
+        /**
+         * @brief Наносит урон кораблю и списывает его груз пропорционально потерянному здоровью
+         * @param target Корабль
+         * @param damage Урон
+         * @param lose_cargo Списывать ли груз корабля
+         * @return HitResult Итог попадания (поле fired не заполняется)
+         */
+        static HitResult apply_damage(IShip* target, double damage, bool lose_cargo);
+};
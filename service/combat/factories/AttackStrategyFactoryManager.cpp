@@ -20,6 +20,11 @@ std::unique_ptr<IAttackStrategy> AttackStrategyFactoryManager::create_strategy(c
     return (it != factories_.end()) ? it->second->create_strategy() : nullptr;
 }
 
+TargetingPolicy AttackStrategyFactoryManager::create_targeting(const std::string& name, IAttackStrategy& strategy) const {
+    auto it = factories_.find(name);
+    return (it != factories_.end()) ? it->second->create_targeting(strategy) : DynamicTargeting{&strategy};
+}
+
 IAttackStrategyFactory* AttackStrategyFactoryManager::get_factory(const std::string& type) const {
     auto it = factories_.find(type);
     return (it != factories_.end()) ? it->second.get() : nullptr;
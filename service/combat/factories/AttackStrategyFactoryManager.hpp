@@ -35,6 +35,15 @@ class AttackStrategyFactoryManager {
          * @return std::unique_ptr<IAttackStrategy> Указатель на созданную стратегию
          */
         std::unique_ptr<IAttackStrategy> create_strategy(const std::string& name) const;
+
+        /**
+         * @brief Выбирает политику выбора цели и оружия для стратегии
+         * @details Для встроенных стратегий возвращает статическую политику, для остальных - DynamicTargeting
+         * @param name Название стратегии
+         * @param strategy Стратегия, созданная по этому названию
+         * @return TargetingPolicy Политика выбора цели и оружия
+         */
+        TargetingPolicy create_targeting(const std::string& name, IAttackStrategy& strategy) const;
         
         /**
          * @brief Получает фабрику по названию стратегии
@@ -7,6 +7,10 @@ std::unique_ptr<IAttackStrategy> ClosestStrategyFactory::create_strategy() const
     return std::make_unique<ClosestStrategy>();
 }
 
+TargetingPolicy ClosestStrategyFactory::create_targeting([[maybe_unused]] IAttackStrategy& strategy) const {
+    return ClosestTargeting{};
+}
+
 std::string ClosestStrategyFactory::get_name() const {
     return "closest";
 }
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "../strategy/IAttackStrategy.hpp"
+#include "../strategy/TargetingPolicy.hpp"
 
 /**
  * @class IAttackStrategyFactory
@@ -23,6 +24,16 @@ class IAttackStrategyFactory {
          * @return std::unique_ptr<IAttackStrategy> Указатель на созданную стратегию
          */
         virtual std::unique_ptr<IAttackStrategy> create_strategy() const = 0;
+
+        /**
+         * @brief Создает политику выбора цели и оружия для специализированного цикла атаки
+         * @details По умолчанию возвращает DynamicTargeting, вызывающую методы стратегии виртуально
+         * @param strategy Стратегия, созданная этой фабрикой
+         * @return TargetingPolicy Политика выбора цели и оружия
+         */
+        virtual TargetingPolicy create_targeting(IAttackStrategy& strategy) const {
+            return DynamicTargeting{&strategy};
+        }
         
         /**
          * @brief Получает название стратегии
@@ -7,6 +7,10 @@ std::unique_ptr<IAttackStrategy> RandomStrategyFactory::create_strategy() const
     return std::make_unique<RandomStrategy>();
 }
 
+TargetingPolicy RandomStrategyFactory::create_targeting([[maybe_unused]] IAttackStrategy& strategy) const {
+    return RandomTargeting{};
+}
+
 std::string RandomStrategyFactory::get_name() const {
     return "random";
 }
@@ -7,6 +7,10 @@ std::unique_ptr<IAttackStrategy> StrongestStrategyFactory::create_strategy() con
     return std::make_unique<StrongestStrategy>();
 }
 
+TargetingPolicy StrongestStrategyFactory::create_targeting([[maybe_unused]] IAttackStrategy& strategy) const {
+    return StrongestTargeting{};
+}
+
 std::string StrongestStrategyFactory::get_name() const {
     return "strongest";
 }
@@ -7,6 +7,10 @@ std::unique_ptr<IAttackStrategy> WeakestStrategyFactory::create_strategy() const
     return std::make_unique<WeakestStrategy>();
 }
 
+TargetingPolicy WeakestStrategyFactory::create_targeting([[maybe_unused]] IAttackStrategy& strategy) const {
+    return WeakestTargeting{};
+}
+
 std::string WeakestStrategyFactory::get_name() const {
     return "weakest";
 }
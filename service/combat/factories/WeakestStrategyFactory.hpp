@@ -19,6 +19,7 @@ class WeakestStrategyFactory : public IAttackStrategyFactory {
         ~WeakestStrategyFactory() override;
 
         std::unique_ptr<IAttackStrategy> create_strategy() const override;
+        TargetingPolicy create_targeting(IAttackStrategy& strategy) const override;
         std::string get_name() const override;
         std::string get_description() const override;
 };
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "ClosestStrategy.hpp"
+#include "TargetingPolicy.hpp"
 #include "../../../visitor/place/PlaceForDPSVisitor.hpp"
 #include <limits>
 
@@ -28,6 +29,10 @@ IShip* ClosestStrategy::select_target(IShip* attacker, const std::vector<IShip*>
     return closest;
 }
 
+IShip* ClosestStrategy::select_target(IShip* attacker, const TargetBoard& targets) {
+    return ClosestTargeting{}.select_target(attacker, targets);
+}
+
 std::optional<PlaceForWeapon> ClosestStrategy::select_weapon_place(IShip* attacker, IShip* target) {
     if (!attacker || !attacker->is_alive()) return PlaceForWeapon::bow;
     double distance = 0.0;
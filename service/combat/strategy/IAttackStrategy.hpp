@@ -7,6 +7,7 @@
 
 #include "../../../entity/ship/Interfaces/IShip.hpp"
 #include "../../../auxiliary/PlaceForWeapon.hpp"
+#include "TargetBoard.hpp"
 #include <optional>
 #include <vector>
 
@@ -40,6 +41,18 @@ class IAttackStrategy {
          * @return IShip* Выбранная цель или nullptr если целей нет
          */
         virtual IShip* select_target(IShip* attacker, const std::vector<IShip*>& possible_targets) = 0;
+
+        /**
+         * @brief Выбирает цель для атаки из подготовленного на раунд набора целей
+         * @details По умолчанию сводится к выбору из вектора живых целей; стратегии переопределяют метод,
+         * чтобы пользоваться упорядоченными структурами TargetBoard
+         * @param attacker Атакующий корабль
+         * @param targets Набор целей раунда
+         * @return IShip* Выбранная цель или nullptr если целей нет
+         */
+        virtual IShip* select_target(IShip* attacker, const TargetBoard& targets) {
+            return select_target(attacker, targets.alive_ships());
+        }
         
         /**
          * @brief Выбирает место для оружия для атаки
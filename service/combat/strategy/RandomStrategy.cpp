@@ -1,4 +1,5 @@
 #include "RandomStrategy.hpp"
+#include "TargetingPolicy.hpp"
 #include "../../../visitor/place/PlaceForDPSVisitor.hpp"
 #include <cmath>
 #include <chrono>
@@ -29,6 +30,10 @@ IShip* RandomStrategy::select_target(IShip* attacker, const std::vector<IShip*>&
     return alive_targets[index];
 }
 
+IShip* RandomStrategy::select_target(IShip* attacker, const TargetBoard& targets) {
+    return RandomTargeting{}.select_target(attacker, targets);
+}
+
 std::optional<PlaceForWeapon> RandomStrategy::select_weapon_place(IShip* attacker, IShip* target) {
     if (!attacker || !attacker->is_alive()) return PlaceForWeapon::bow;
     double distance = 0.0;
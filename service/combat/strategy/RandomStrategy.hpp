@@ -30,5 +30,6 @@ class RandomStrategy : public IAttackStrategy {
         std::string get_description() const override;
         
         IShip* select_target(IShip* attacker, const std::vector<IShip*>& possible_targets) override;
+        IShip* select_target(IShip* attacker, const TargetBoard& targets) override;
         std::optional<PlaceForWeapon> select_weapon_place(IShip* attacker, IShip* target) override;
 };
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include "SpatialGrid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+int32_t SpatialGrid::cell_coord(double value) const {
+    return static_cast<int32_t>(std::floor(value / cell_size_));
+}
+
+uint64_t SpatialGrid::cell_key(int32_t cx, int32_t cy) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy);
+}
+
+SpatialGrid::SpatialGrid(const std::vector<IShip*>& ships, double cell_size) : cell_size_(cell_size) {
+    if (cell_size <= 0.0) throw std::invalid_argument("Cell size must be positive");
+
+    std::vector<std::pair<uint64_t, Entry>> keyed;
+    keyed.reserve(ships.size());
+    for (auto ship : ships) {
+        if (!ship) continue;
+        Vector position = ship->get_position();
+        keyed.push_back({cell_key(cell_coord(position.x), cell_coord(position.y)), Entry{ship, position}});
+    }
+    std::stable_sort(keyed.begin(), keyed.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    entries_.reserve(keyed.size());
+    for (size_t i = 0; i < keyed.size(); ++i) {
+        if (i == 0 || keyed[i].first != keyed[i - 1].first) cells_[keyed[i].first] = {i, i};
+        cells_[keyed[i].first].second = i + 1;
+        entries_.push_back(keyed[i].second);
+    }
+}
+
+std::vector<IShip*> SpatialGrid::query(const Vector& center, double radius) const {
+    std::vector<IShip*> result;
+    if (radius < 0.0 || entries_.empty()) return result;
+
+    int32_t min_x = cell_coord(center.x - radius);
+    int32_t max_x = cell_coord(center.x + radius);
+    int32_t min_y = cell_coord(center.y - radius);
+    int32_t max_y = cell_coord(center.y + radius);
+    double radius_sq = radius * radius;
+
+    for (int32_t cx = min_x; cx <= max_x; ++cx) {
+        for (int32_t cy = min_y; cy <= max_y; ++cy) {
+            auto it = cells_.find(cell_key(cx, cy));
+            if (it == cells_.end()) continue;
+            for (size_t i = it->second.first; i < it->second.second; ++i) {
+                double dx = entries_[i].position.x - center.x;
+                double dy = entries_[i].position.y - center.y;
+                if (dx * dx + dy * dy <= radius_sq) result.push_back(entries_[i].ship);
+            }
+        }
+    }
+    return result;
+}
+
+size_t SpatialGrid::size() const {
+    return entries_.size();
+}
@@ -0,0 +1,71 @@
+/**
+ * @file SpatialGrid.hpp
+ * @brief Заголовочный файл, содержащий определение класса SpatialGrid
+ */
+
+#pragma once
+
+#include "../../../entity/ship/Interfaces/IShip.hpp"
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+/**
+ * @class SpatialGrid
+ * @brief Равномерная сетка для поиска кораблей в заданном радиусе
+ * @details Корабли раскладываются по квадратным ячейкам и хранятся в одном массиве, упорядоченном по ячейкам.
+ * Запрос проверяет только ячейки, пересекающие квадрат вокруг окружности поиска.
+ * После построения сетка не изменяется, поэтому запросы можно выполнять из нескольких потоков без блокировок.
+ */
+class SpatialGrid {
+    private:
+        /**
+         * @struct Entry
+         * @brief Корабль и его позиция на момент построения сетки
+         */
+        struct Entry {
+            IShip* ship; ///< Указатель на корабль
+            Vector position; ///< Позиция корабля
+        };
+
+        double cell_size_; ///< Размер стороны ячейки
+        std::vector<Entry> entries_; ///< Корабли, упорядоченные по ячейкам
+        std::unordered_map<uint64_t, std::pair<size_t, size_t>> cells_; ///< Диапазон entries_ для каждой непустой ячейки
+
+        /**
+         * @brief Вычисляет координату ячейки по координате точки
+         * @param value Координата точки
+         * @return int32_t Координата ячейки
+         */
+        int32_t cell_coord(double value) const;
+
+        /**
+         * @brief Упаковывает координаты ячейки в ключ
+         * @param cx Координата ячейки по оси X
+         * @param cy Координата ячейки по оси Y
+         * @return uint64_t Ключ ячейки
+         */
+        static uint64_t cell_key(int32_t cx, int32_t cy);
+    public:
+        /**
+         * @brief Конструктор
+         * @param ships Корабли (пустые указатели пропускаются)
+         * @param cell_size Размер стороны ячейки
+         * @throws std::invalid_argument Если размер ячейки не положителен
+         */
+        SpatialGrid(const std::vector<IShip*>& ships, double cell_size);
+
+        /**
+         * @brief Находит корабли в заданном радиусе
+         * @param center Центр окружности поиска
+         * @param radius Радиус поиска
+         * @return std::vector<IShip*> Корабли, находившиеся при построении сетки не дальше radius от center
+         */
+        std::vector<IShip*> query(const Vector& center, double radius) const;
+
+        /**
+         * @brief Получает количество кораблей в сетке
+         * @return size_t Количество кораблей
+         */
+        size_t size() const;
+};
@@ -1,4 +1,5 @@
 #include "StrongestStrategy.hpp"
+#include "TargetingPolicy.hpp"
 #include "../../../visitor/place/PlaceForDamageVisitor.hpp"
 #include <cmath>
 
@@ -28,6 +29,10 @@ IShip* StrongestStrategy::select_target(IShip* attacker, const std::vector<IShip
     return strongest;
 }
 
+IShip* StrongestStrategy::select_target(IShip* attacker, const TargetBoard& targets) {
+    return StrongestTargeting{}.select_target(attacker, targets);
+}
+
 std::optional<PlaceForWeapon> StrongestStrategy::select_weapon_place(IShip* attacker, IShip* target) {    
     if (!attacker || !attacker->is_alive()) return PlaceForWeapon::bow;
     double distance = 0.0;
@@ -0,0 +1,165 @@
+#include "TargetBoard.hpp"
+#include <limits>
+
+size_t TargetBoard::pick_min(size_t a, size_t b) const {
+    if (a == npos) return b;
+    if (b == npos) return a;
+    return health_[b] < health_[a] ? b : a;
+}
+
+size_t TargetBoard::pick_max(size_t a, size_t b) const {
+    if (a == npos) return b;
+    if (b == npos) return a;
+    return health_[b] > health_[a] ? b : a;
+}
+
+void TargetBoard::refresh_path(size_t index) {
+    size_t node = leaf_offset_ + index;
+    bool alive = alive_position_[index] != npos;
+    min_tree_[node] = alive ? index : npos;
+    max_tree_[node] = alive ? index : npos;
+    for (node /= 2; node > 0; node /= 2) {
+        min_tree_[node] = pick_min(min_tree_[2 * node], min_tree_[2 * node + 1]);
+        max_tree_[node] = pick_max(max_tree_[2 * node], max_tree_[2 * node + 1]);
+    }
+    weakest_.store(min_tree_[1], std::memory_order_release);
+    strongest_.store(max_tree_[1], std::memory_order_release);
+}
+
+IShip* TargetBoard::alive_or_null(size_t index) const {
+    if (index == npos) return nullptr;
+    IShip* ship = ships_[index];
+    return ship->is_alive() ? ship : nullptr;
+}
+
+std::vector<IShip*> TargetBoard::collect_alive(const std::vector<IShip*>& ships) {
+    std::vector<IShip*> result;
+    result.reserve(ships.size());
+    for (auto ship : ships) {
+        if (ship && ship->is_alive()) result.push_back(ship);
+    }
+    return result;
+}
+
+TargetBoard::TargetBoard(const std::vector<IShip*>& ships) : ships_(collect_alive(ships)), grid_(ships_, grid_cell_size) {
+    while (leaf_offset_ < ships_.size()) leaf_offset_ *= 2;
+
+    health_.resize(ships_.size());
+    alive_ = std::make_unique<std::atomic<size_t>[]>(ships_.size());
+    alive_position_.resize(ships_.size());
+    index_.reserve(ships_.size());
+    min_tree_.assign(2 * leaf_offset_, npos);
+    max_tree_.assign(2 * leaf_offset_, npos);
+
+    for (size_t i = 0; i < ships_.size(); ++i) {
+        health_[i] = ships_[i]->get_health();
+        alive_position_[i] = i;
+        alive_[i].store(i, std::memory_order_relaxed);
+        index_.emplace(ships_[i], i);
+        min_tree_[leaf_offset_ + i] = i;
+        max_tree_[leaf_offset_ + i] = i;
+    }
+    for (size_t node = leaf_offset_ - 1; node > 0; --node) {
+        min_tree_[node] = pick_min(min_tree_[2 * node], min_tree_[2 * node + 1]);
+        max_tree_[node] = pick_max(max_tree_[2 * node], max_tree_[2 * node + 1]);
+    }
+    weakest_.store(min_tree_[1], std::memory_order_relaxed);
+    strongest_.store(max_tree_[1], std::memory_order_relaxed);
+    alive_count_.store(ships_.size(), std::memory_order_release);
+}
+
+void TargetBoard::update(const IShip* ship) {
+    std::lock_guard<std::mutex> lock(update_mutex_);
+    auto it = index_.find(ship);
+    if (it == index_.end()) return;
+    size_t index = it->second;
+    if (alive_position_[index] == npos) return;
+
+    health_[index] = ship->get_health();
+    if (!ship->is_alive() || health_[index] <= 0.0) {
+        size_t position = alive_position_[index];
+        size_t last = alive_count_.load(std::memory_order_relaxed) - 1;
+        size_t moved = alive_[last].load(std::memory_order_relaxed);
+        alive_[position].store(moved, std::memory_order_release);
+        alive_position_[moved] = position;
+        alive_position_[index] = npos;
+        alive_count_.store(last, std::memory_order_release);
+    }
+    refresh_path(index);
+}
+
+IShip* TargetBoard::select_locked(const std::vector<size_t>& tree, size_t (TargetBoard::*pick)(size_t, size_t) const) const {
+    std::lock_guard<std::mutex> lock(update_mutex_);
+    if (IShip* ship = alive_or_null(tree[1])) return ship;
+    size_t count = alive_count_.load(std::memory_order_relaxed);
+    size_t result = npos;
+    for (size_t position = 0; position < count; ++position) {
+        size_t index = alive_[position].load(std::memory_order_relaxed);
+        if (ships_[index]->is_alive()) result = (this->*pick)(result, index);
+    }
+    return alive_or_null(result);
+}
+
+IShip* TargetBoard::weakest() const {
+    if (IShip* ship = alive_or_null(weakest_.load(std::memory_order_acquire))) return ship;
+    if (alive_count_.load(std::memory_order_acquire) == 0) return nullptr;
+    return select_locked(min_tree_, &TargetBoard::pick_min);
+}
+
+IShip* TargetBoard::strongest() const {
+    if (IShip* ship = alive_or_null(strongest_.load(std::memory_order_acquire))) return ship;
+    if (alive_count_.load(std::memory_order_acquire) == 0) return nullptr;
+    return select_locked(max_tree_, &TargetBoard::pick_max);
+}
+
+IShip* TargetBoard::random(std::mt19937& rng) const {
+    // Цель, потопленная одновременно с выбором, может еще оставаться в массиве: выбираем заново
+    for (size_t attempt = 0; attempt < 4; ++attempt) {
+        size_t count = alive_count_.load(std::memory_order_acquire);
+        if (count == 0) return nullptr;
+        std::uniform_int_distribution<size_t> dist(0, count - 1);
+        IShip* ship = alive_or_null(alive_[dist(rng)].load(std::memory_order_acquire));
+        if (ship) return ship;
+    }
+    return nullptr;
+}
+
+std::vector<IShip*> TargetBoard::alive_ships() const {
+    size_t count = alive_count_.load(std::memory_order_acquire);
+    std::vector<IShip*> result;
+    result.reserve(count);
+    for (size_t position = 0; position < count; ++position) {
+        IShip* ship = alive_or_null(alive_[position].load(std::memory_order_acquire));
+        if (ship) result.push_back(ship);
+    }
+    return result;
+}
+
+IShip* TargetBoard::closest(const Vector& position) const {
+    size_t count = alive_count_.load(std::memory_order_acquire);
+    IShip* result = nullptr;
+    double min_distance = std::numeric_limits<double>::max();
+    for (size_t k = 0; k < count; ++k) {
+        IShip* ship = alive_or_null(alive_[k].load(std::memory_order_acquire));
+        if (!ship) continue;
+        Vector target = ship->get_position();
+        double dx = target.x - position.x;
+        double dy = target.y - position.y;
+        double distance = dx * dx + dy * dy;
+        if (distance < min_distance) {
+            min_distance = distance;
+            result = ship;
+        }
+    }
+    return result;
+}
+
+size_t TargetBoard::alive_count() const {
+    return alive_count_.load(std::memory_order_acquire);
+}
+
+std::vector<IShip*> TargetBoard::alive_in_radius(const Vector& center, double radius) const {
+    std::vector<IShip*> result = grid_.query(center, radius);
+    std::erase_if(result, [](const IShip* ship) { return !ship->is_alive(); });
+    return result;
+}
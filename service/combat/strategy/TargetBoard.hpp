@@ -0,0 +1,152 @@
+/**
+ * @file TargetBoard.hpp
+ * @brief Заголовочный файл, содержащий определение класса TargetBoard
+ */
+
+#pragma once
+
+#include "../../../entity/ship/Interfaces/IShip.hpp"
+#include "SpatialGrid.hpp"
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <random>
+
+/**
+ * @class TargetBoard
+ * @brief Общий для всех атакующих одной стороны набор целей на один раунд боя
+ * @details Хранит турнирное дерево по здоровью (минимум и максимум в корне) и плотный массив живых целей.
+ * Поиск самой слабой и самой сильной цели выполняется за O(1), случайной - за O(1), обновление после урона - за O(log n).
+ * Для поиска целей в радиусе взрыва используется пространственная сетка по позициям целей на начало раунда.
+ * Все методы потокобезопасны. Чтение не блокируется: корни деревьев публикуются атомарно после каждого обновления,
+ * а плотный массив живых целей хранит атомарные индексы, поэтому выбор цели не ждет атакующих, наносящих урон.
+ * Под мьютексом выполняются только обновления, которые пересчитывают путь от листа до корня.
+ */
+class TargetBoard {
+    private:
+        static constexpr size_t npos = static_cast<size_t>(-1); ///< Признак отсутствия цели
+        static constexpr double grid_cell_size = 2.0; ///< Размер ячейки сетки (порядка наибольшего радиуса взрыва в каталоге)
+
+        std::vector<IShip*> ships_; ///< Цели в порядке листьев дерева
+        SpatialGrid grid_; ///< Пространственная сетка по позициям целей
+        std::vector<double> health_; ///< Здоровье целей на момент последнего обновления
+        std::vector<size_t> min_tree_; ///< Турнирное дерево индексов целей с минимальным здоровьем
+        std::vector<size_t> max_tree_; ///< Турнирное дерево индексов целей с максимальным здоровьем
+        size_t leaf_offset_ = 1; ///< Индекс первого листа в деревьях
+        std::atomic<size_t> weakest_{npos}; ///< Опубликованный корень дерева минимумов
+        std::atomic<size_t> strongest_{npos}; ///< Опубликованный корень дерева максимумов
+        std::unique_ptr<std::atomic<size_t>[]> alive_; ///< Плотный массив индексов живых целей
+        std::atomic<size_t> alive_count_{0}; ///< Количество живых целей
+        std::vector<size_t> alive_position_; ///< Позиция цели в массиве живых или npos
+        std::unordered_map<const IShip*, size_t> index_; ///< Индекс цели по указателю
+        mutable std::mutex update_mutex_; ///< Мьютекс, упорядочивающий обновления деревьев
+
+        /**
+         * @brief Выбирает цель с меньшим здоровьем (при равенстве - с меньшим индексом)
+         * @param a Индекс первой цели
+         * @param b Индекс второй цели
+         * @return size_t Индекс выбранной цели
+         */
+        size_t pick_min(size_t a, size_t b) const;
+
+        /**
+         * @brief Выбирает цель с большим здоровьем (при равенстве - с меньшим индексом)
+         * @param a Индекс первой цели
+         * @param b Индекс второй цели
+         * @return size_t Индекс выбранной цели
+         */
+        size_t pick_max(size_t a, size_t b) const;
+
+        /**
+         * @brief Пересчитывает узлы деревьев от листа до корня
+         * @param index Индекс цели
+         */
+        void refresh_path(size_t index);
+
+        /**
+         * @brief Получает живую цель по индексу, если она еще жива
+         * @param index Индекс цели или npos
+         * @return IShip* Цель или nullptr
+         */
+        IShip* alive_or_null(size_t index) const;
+
+        /**
+         * @brief Выбирает крайнюю живую цель, когда опубликованный корень уже потоплен
+         * @details Цель могла быть потоплена, а ее обновление еще не выполнено. Под мьютексом обновлений
+         * перечитывается корень дерева, а если и он потоплен - живые цели перебираются по сохраненному здоровью.
+         * @param tree Дерево минимумов или максимумов
+         * @param pick Функция выбора из двух целей
+         * @return IShip* Цель или nullptr, если живых целей нет
+         */
+        IShip* select_locked(const std::vector<size_t>& tree, size_t (TargetBoard::*pick)(size_t, size_t) const) const;
+
+        /**
+         * @brief Отбирает живые корабли
+         * @param ships Корабли
+         * @return std::vector<IShip*> Непустые указатели на живые корабли
+         */
+        static std::vector<IShip*> collect_alive(const std::vector<IShip*>& ships);
+    public:
+        /**
+         * @brief Конструктор
+         * @param ships Возможные цели (пустые указатели и потопленные корабли пропускаются)
+         */
+        explicit TargetBoard(const std::vector<IShip*>& ships);
+
+        TargetBoard(const TargetBoard&) = delete;
+        TargetBoard& operator=(const TargetBoard&) = delete;
+
+        /**
+         * @brief Перечитывает здоровье цели после атаки и убирает ее, если она потоплена
+         * @param ship Указатель на цель
+         */
+        void update(const IShip* ship);
+
+        /**
+         * @brief Получает живую цель с наименьшим здоровьем
+         * @return IShip* Цель или nullptr, если живых целей нет
+         */
+        IShip* weakest() const;
+
+        /**
+         * @brief Получает живую цель с наибольшим здоровьем
+         * @return IShip* Цель или nullptr, если живых целей нет
+         */
+        IShip* strongest() const;
+
+        /**
+         * @brief Получает случайную живую цель
+         * @param rng Генератор случайных чисел
+         * @return IShip* Цель или nullptr, если живых целей нет
+         */
+        IShip* random(std::mt19937& rng) const;
+
+        /**
+         * @brief Получает живые цели
+         * @return std::vector<IShip*> Вектор указателей на живые цели
+         */
+        std::vector<IShip*> alive_ships() const;
+
+        /**
+         * @brief Находит ближайшую живую цель, не копируя набор целей
+         * @param position Точка, от которой измеряется расстояние
+         * @return IShip* Цель или nullptr, если живых целей нет
+         */
+        IShip* closest(const Vector& position) const;
+
+        /**
+         * @brief Получает количество живых целей
+         * @return size_t Количество живых целей
+         */
+        size_t alive_count() const;
+
+        /**
+         * @brief Находит живые цели в заданном радиусе
+         * @param center Центр окружности поиска
+         * @param radius Радиус поиска
+         * @return std::vector<IShip*> Вектор указателей на живые цели в радиусе
+         */
+        std::vector<IShip*> alive_in_radius(const Vector& center, double radius) const;
+};
@@ -0,0 +1,153 @@
+/**
+ * @file TargetingPolicy.hpp
+ * @brief Заголовочный файл, содержащий определение статических политик выбора цели и оружия
+ */
+
+#pragma once
+
+#include "IAttackStrategy.hpp"
+#include "TargetBoard.hpp"
+#include "../../../entity/ship/Abstracts/DefaultGuard.hpp"
+#include <variant>
+#include <chrono>
+
+/**
+ * @struct DamageWeaponChoice
+ * @brief Выбор оружия с максимальным уроном, достающего до цели
+ */
+struct DamageWeaponChoice {
+    /**
+     * @brief Выбирает место оружия
+     * @param attacker Атакующий корабль
+     * @param guard Вооружение атакующего корабля или nullptr
+     * @param target Целевой корабль
+     * @param distance Расстояние до цели
+     * @return std::optional<PlaceForWeapon> Место оружия или std::nullopt, если корабль не вооружен
+     */
+    std::optional<PlaceForWeapon> select_weapon_place([[maybe_unused]] IShip* attacker, const DefaultGuard* guard, [[maybe_unused]] IShip* target, double distance) const {
+        if (!guard) return std::nullopt;
+        return guard->best_place_by_damage(distance).value_or(PlaceForWeapon::bow);
+    }
+};
+
+/**
+ * @struct DPSWeaponChoice
+ * @brief Выбор оружия с максимальным DPS, достающего до цели
+ */
+struct DPSWeaponChoice {
+    /**
+     * @brief Выбирает место оружия
+     * @param attacker Атакующий корабль
+     * @param guard Вооружение атакующего корабля или nullptr
+     * @param target Целевой корабль
+     * @param distance Расстояние до цели
+     * @return std::optional<PlaceForWeapon> Место оружия или std::nullopt, если корабль не вооружен
+     */
+    std::optional<PlaceForWeapon> select_weapon_place([[maybe_unused]] IShip* attacker, const DefaultGuard* guard, [[maybe_unused]] IShip* target, double distance) const {
+        if (!guard) return std::nullopt;
+        return guard->best_place_by_dps(distance).value_or(PlaceForWeapon::bow);
+    }
+};
+
+/**
+ * @struct WeakestTargeting
+ * @brief Политика стратегии "weakest": цель с наименьшим здоровьем, оружие с максимальным уроном
+ */
+struct WeakestTargeting : DamageWeaponChoice {
+    /**
+     * @brief Выбирает цель
+     * @param attacker Атакующий корабль
+     * @param targets Набор целей раунда
+     * @return IShip* Цель или nullptr
+     */
+    IShip* select_target([[maybe_unused]] IShip* attacker, const TargetBoard& targets) const {
+        return targets.weakest();
+    }
+};
+
+/**
+ * @struct StrongestTargeting
+ * @brief Политика стратегии "strongest": цель с наибольшим здоровьем, оружие с максимальным уроном
+ */
+struct StrongestTargeting : DamageWeaponChoice {
+    /**
+     * @brief Выбирает цель
+     * @param attacker Атакующий корабль
+     * @param targets Набор целей раунда
+     * @return IShip* Цель или nullptr
+     */
+    IShip* select_target([[maybe_unused]] IShip* attacker, const TargetBoard& targets) const {
+        return targets.strongest();
+    }
+};
+
+/**
+ * @struct ClosestTargeting
+ * @brief Политика стратегии "closest": ближайшая цель, оружие с максимальным DPS
+ */
+struct ClosestTargeting : DPSWeaponChoice {
+    /**
+     * @brief Выбирает цель
+     * @param attacker Атакующий корабль
+     * @param targets Набор целей раунда
+     * @return IShip* Цель или nullptr
+     */
+    IShip* select_target(IShip* attacker, const TargetBoard& targets) const {
+        return attacker ? targets.closest(attacker->get_position()) : nullptr;
+    }
+};
+
+/**
+ * @struct RandomTargeting
+ * @brief Политика стратегии "random": случайная живая цель, оружие с максимальным DPS
+ */
+struct RandomTargeting : DPSWeaponChoice {
+    /**
+     * @brief Выбирает цель
+     * @param attacker Атакующий корабль
+     * @param targets Набор целей раунда
+     * @return IShip* Цель или nullptr
+     */
+    IShip* select_target([[maybe_unused]] IShip* attacker, const TargetBoard& targets) const {
+        thread_local std::mt19937 local_rng(std::chrono::steady_clock::now().time_since_epoch().count());
+        return targets.random(local_rng);
+    }
+};
+
+/**
+ * @struct DynamicTargeting
+ * @brief Политика, делегирующая выбор полиморфной стратегии (для стратегий, зарегистрированных пользователем)
+ */
+struct DynamicTargeting {
+    IAttackStrategy* strategy = nullptr; ///< Стратегия атаки
+
+    /**
+     * @brief Выбирает цель
+     * @param attacker Атакующий корабль
+     * @param targets Набор целей раунда
+     * @return IShip* Цель или nullptr
+     */
+    IShip* select_target(IShip* attacker, const TargetBoard& targets) const {
+        return strategy ? strategy->select_target(attacker, targets) : nullptr;
+    }
+
+    /**
+     * @brief Выбирает место оружия
+     * @param attacker Атакующий корабль
+     * @param guard Вооружение атакующего корабля или nullptr
+     * @param target Целевой корабль
+     * @param distance Расстояние до цели
+     * @return std::optional<PlaceForWeapon> Место оружия или std::nullopt
+     */
+    std::optional<PlaceForWeapon> select_weapon_place(IShip* attacker, [[maybe_unused]] const DefaultGuard* guard, IShip* target, [[maybe_unused]] double distance) const {
+        if (!strategy) return PlaceForWeapon::bow;
+        return strategy->select_weapon_place(attacker, target);
+    }
+};
+
+/**
+ * @brief Политика выбора цели и оружия, известная на этапе компиляции
+ * @details Цикл атаки инстанцируется для каждой альтернативы, поэтому для встроенных стратегий выбор цели и оружия
+ * встраивается в цикл без виртуальных вызовов и посетителей
+ */
+using TargetingPolicy = std::variant<WeakestTargeting, StrongestTargeting, ClosestTargeting, RandomTargeting, DynamicTargeting>;
@@ -1,4 +1,5 @@
 #include "WeakestStrategy.hpp"
+#include "TargetingPolicy.hpp"
 #include "../../../visitor/place/PlaceForDamageVisitor.hpp"
 #include <cmath>
 
@@ -28,6 +29,10 @@ IShip* WeakestStrategy::select_target(IShip* attacker, const std::vector<IShip*>
     return weakest;
 }
 
+IShip* WeakestStrategy::select_target(IShip* attacker, const TargetBoard& targets) {
+    return WeakestTargeting{}.select_target(attacker, targets);
+}
+
 std::optional<PlaceForWeapon> WeakestStrategy::select_weapon_place(IShip* attacker, IShip* target) {    
     if (!attacker || !attacker->is_alive()) return PlaceForWeapon::bow;
     double distance = 0.0;
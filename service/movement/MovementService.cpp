@@ -1,4 +1,5 @@
 #include "MovementService.hpp"
+#include "../../auxiliary/Tracer.hpp"
 #include <cmath>
 
 double MovementService::get_distance_between(const Vector& from, const Vector& to) const {
@@ -23,15 +24,18 @@ Vector MovementService::calculate_direction(const Vector& start, const Vector& e
 }
 
 void MovementService::update_convoy(double delta_time) {
+    TRACE_SPAN("movement", "MovementService::update_convoy");
     auto ships = convoy_repo_.get_alive_ships();
     if (ships.empty()) return;
     Vector direction = calculate_direction(mission_.get_base_a(), mission_.get_base_b());
     for (auto ship : ships) {
         move_ship(ship, direction, convoy_speed_, delta_time);
     }
+    mission_.touch();
 }
 
 void MovementService::update_pirates(double delta_time) {
+    TRACE_SPAN("movement", "MovementService::update_pirates");
     auto pirates = pirate_repo_.get_alive_ships();
     if (pirates.empty()) return;
     Vector convoy_center = get_convoy_center();
@@ -40,6 +44,7 @@ void MovementService::update_pirates(double delta_time) {
             move_ship(pirate, calculate_direction(pirate->get_position(), convoy_center), pirate->get_speed(), delta_time);
         }
     }
+    mission_.touch();
 }
 
 size_t MovementService::count_convoy_ships() const {
@@ -68,6 +73,7 @@ Vector MovementService::get_convoy_target_position() const {
 MovementService::MovementService(Mission& mission, ShipRepository& convoy_repo, PirateRepository& pirate_repo) : mission_(mission), convoy_repo_(convoy_repo), pirate_repo_(pirate_repo) {}
 
 void MovementService::update(double delta_time) {
+    TRACE_SPAN("movement", "MovementService::update");
     if (!is_moving_ || delta_time <= 0) return;
     update_convoy(delta_time);
     convoy_speed_ = calculate_convoy_speed();
@@ -81,12 +87,14 @@ void MovementService::start_movement() {
     for (auto ship : ships) {
         ship->set_speed(ship->get_max_speed());
     }
+    mission_.touch();
 }
 void MovementService::start_pirate_movement() {
     auto pirates = pirate_repo_.get_alive_ships();
     for (auto pirate : pirates) {
         pirate->set_speed(pirate->get_max_speed());
     }
+    mission_.touch();
 }
 
 void MovementService::stop_movement() {
@@ -97,12 +105,14 @@ void MovementService::stop_movement() {
         ship->set_speed(0.0);
     }
     convoy_speed_ = 0.0;
+    mission_.touch();
 }
 void MovementService::stop_pirate_movement() {
     auto pirates = pirate_repo_.get_alive_ships();
     for (auto pirate : pirates) {
         pirate->set_speed(0.0);
     }
+    mission_.touch();
 }
 
 bool MovementService::is_moving() const {
@@ -144,4 +154,5 @@ Vector MovementService::get_convoy_center() const {
 void MovementService::reset() {
     is_moving_ = false;
     convoy_speed_ = 0.0;
+    mission_.touch();
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "PirateSpawnService.hpp"
+#include "../../auxiliary/Tracer.hpp"
 #include "../../visitor/weapon/WeaponInstallationVisitor.hpp"
+#include "../ID/ShipIDGenerator.hpp"
 #include <stdexcept>
 #include <chrono>
 
@@ -16,7 +18,7 @@ Vector PirateSpawnService::generate_random_offset() {
 }
 
 std::unique_ptr<IShip> PirateSpawnService::create_pirate_ship(const Vector& position) {
-    auto ship = ship_catalog_.create_ship("guard_medium", false, position);
+    auto ship = ship_catalog_.create_ship_without_id("guard_medium", false, position);
     if (!ship) return nullptr;
     ship->set_name("Пират");
     
@@ -44,30 +46,70 @@ std::unique_ptr<IShip> PirateSpawnService::create_pirate_ship(const Vector& posi
     return ship;
 }
 
+const IShip* PirateSpawnService::get_prototype() {
+    if (!prototype_) prototype_ = create_pirate_ship(Vector());
+    return prototype_.get();
+}
+
+std::vector<Vector> PirateSpawnService::generate_offsets(size_t count) {
+    std::vector<Vector> offsets;
+    offsets.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        double offset_x = position_offset_dist_(rng_);
+        double offset_y = position_offset_dist_(rng_);
+        offsets.emplace_back(offset_x, offset_y);
+    }
+    return offsets;
+}
+
+size_t PirateSpawnService::spawn_batch(const Vector& center, size_t count, std::vector<std::string>& ids) {
+    TRACE_SPAN("spawn", "PirateSpawnService::spawn_batch");
+    const IShip* prototype = get_prototype();
+    if (!prototype || count == 0) return 0;
+
+    std::vector<Vector> offsets = generate_offsets(count);
+    std::vector<std::unique_ptr<IShip>> ships;
+    std::vector<std::string> batch_ids;
+    ships.reserve(count);
+    batch_ids.reserve(count);
+    for (const auto& offset : offsets) {
+        auto pirate_ship = prototype->clone();
+        pirate_ship->set_ID(ShipIDGenerator::generate_pirate_id());
+        pirate_ship->set_position(Vector(center.x + offset.x, center.y + offset.y));
+        batch_ids.push_back(pirate_ship->get_ID());
+        ships.push_back(std::move(pirate_ship));
+    }
+
+    pirate_repo_.create_batch(std::move(ships));
+    ids.insert(ids.end(), std::make_move_iterator(batch_ids.begin()), std::make_move_iterator(batch_ids.end()));
+    total_pirates_spawned_ += count;
+    mission_.touch();
+    return count;
+}
+
 void PirateSpawnService::spawn_pirates_at_base(PirateBase& base) {
     if (base.is_activated) return;
-    
+
+    std::vector<std::string> ids;
+    spawn_batch(base.position, base.ship_count, ids);
+    base.spawned_pirate_ids = std::move(ids);
     base.is_activated = true;
-    base.spawned_pirate_ids.clear();
-    
-    for (size_t i = 0; i < base.ship_count; ++i) {
-        Vector offset = generate_random_offset();
-        Vector ship_position = Vector(base.position.x + offset.x, base.position.y + offset.y);
-        
-        auto pirate_ship = create_pirate_ship(ship_position);
-        if (pirate_ship) {
-            base.spawned_pirate_ids.push_back(pirate_ship->get_ID());
-            pirate_repo_.create(std::move(pirate_ship));
-            ++total_pirates_spawned_;
-        }
-    }
+    mission_.touch();
+}
+
+size_t PirateSpawnService::spawn_pirates_at_position(const Vector& position, size_t count) {
+    std::vector<std::string> ids;
+    return spawn_batch(position, count, ids);
 }
 
 void PirateSpawnService::update_base_status(PirateBase& base) {
     if (!base.is_activated || base.is_defeated) return;
 
     size_t active_pirates = pirate_repo_.count_alive();
-    if (active_pirates == 0) base.is_defeated = true;
+    if (active_pirates == 0) {
+        base.is_defeated = true;
+        mission_.touch();
+    }
 }
 
 PirateSpawnService::PirateSpawnService(Mission& mission, PirateRepository& pirate_repo, ShipCatalog& ship_catalog, WeaponCatalog& weapon_catalog, Level level) :
@@ -85,6 +127,7 @@ void PirateSpawnService::set_seed(size_t seed) {
 }
 
 void PirateSpawnService::update(const Vector& convoy_position) {
+    TRACE_SPAN("spawn", "PirateSpawnService::update");
     for (size_t i = 0; i < mission_.count_pirate_bases(); ++i) {
         PirateBase& base = mission_.get_pirate_base(i);
         if (!base.is_activated && !base.is_defeated) {
@@ -112,8 +155,7 @@ size_t PirateSpawnService::get_active_base_count() const {
 
 size_t PirateSpawnService::get_defeated_base_count() const {
     size_t result = 0;
-    std::vector<PirateBase> pbases = mission_.get_pirate_bases();
-    for (const auto& pb : pbases) {
+    for (const auto& pb : mission_.get_pirate_bases()) {
         if (pb.is_defeated) ++result;
     }
     return result;
@@ -39,6 +39,7 @@ class PirateSpawnService {
         std::uniform_real_distribution<double> position_offset_dist_; ///< Распределение для случайного смещения позиции
         
         size_t total_pirates_spawned_; ///< Общее количество созданных пиратов
+        std::unique_ptr<IShip> prototype_; ///< Вооруженный прототип пирата для текущего уровня сложности
         
         /**
          * @brief Вычисляет расстояние между двумя точками
@@ -49,12 +50,28 @@ class PirateSpawnService {
         double calculate_distance(const Vector& a, const Vector& b) const;
         
         /**
-         * @brief Создает пиратский корабль
+         * @brief Создает пиратский корабль без идентификатора
          * @param position Позиция корабля
          * @return std::unique_ptr<IShip> Указатель на созданный пиратский корабль
          */
         std::unique_ptr<IShip> create_pirate_ship(const Vector& position);
         
+        /**
+         * @brief Получает прототип пирата, создавая его при первом обращении
+         * @details Создание прототипа не расходует идентификатор пиратского корабля
+         * @return const IShip* Указатель на прототип или nullptr, если корабль не удалось создать
+         */
+        const IShip* get_prototype();
+
+        /**
+         * @brief Создает пачку пиратов копированием прототипа и добавляет их в репозиторий одной операцией
+         * @param center Центр области появления
+         * @param count Количество пиратов
+         * @param ids Вектор, в который добавляются идентификаторы созданных пиратов (только после успешного добавления в репозиторий)
+         * @return size_t Количество созданных пиратов
+         */
+        size_t spawn_batch(const Vector& center, size_t count, std::vector<std::string>& ids);
+
         /**
          * @brief Создает пиратов на базе
          * @param base Пиратская база
@@ -88,7 +105,13 @@ class PirateSpawnService {
          */
         void clear_bases();
         
-        // size_t spawn_pirates_at_position(const Vector& position, size_t count);
+        /**
+         * @brief Создает пиратов вокруг заданной позиции
+         * @param position Центр области появления
+         * @param count Количество пиратов
+         * @return size_t Количество созданных пиратов
+         */
+        size_t spawn_pirates_at_position(const Vector& position, size_t count);
         
         /**
          * @brief Получает пиратские базы
@@ -133,5 +156,12 @@ class PirateSpawnService {
          */
         Vector generate_random_offset();
 
+        /**
+         * @brief Генерирует пачку случайных смещений
+         * @param count Количество смещений
+         * @return std::vector<Vector> Вектор смещений
+         */
+        std::vector<Vector> generate_offsets(size_t count);
+
         void set_seed(size_t seed);
 };
\ No newline at end of file
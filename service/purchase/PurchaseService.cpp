@@ -3,6 +3,9 @@
 #include "../../visitor/weapon/WeaponRemovalVisitor.hpp"
 #include "../../visitor/weapon/ShipSellVisitor.hpp"
 #include "../../visitor/place/HasPlaceWeaponVisitor.hpp"
+#include "../../entity/ship/Abstracts/DefaultGuard.hpp"
+#include "../ID/ShipIDGenerator.hpp"
+#include <unordered_set>
 
 bool PurchaseService::spend_money(double amount) {
     return mission_.remove_budget(amount);
@@ -49,9 +52,46 @@ bool PurchaseService::buy_ship(const std::string& template_id, bool is_convoy, c
         return false;
     }
     
+    mission_.touch();
     return true;
 }
 
+std::vector<std::string> PurchaseService::buy_ships(const std::string& template_id, const std::vector<Vector>& positions, bool is_convoy) {
+    const ShipTemplate* temp = ship_catalog_.find_template_by_id(template_id);
+    if (!temp || positions.empty()) return {};
+    double total_cost = temp->cost * positions.size();
+    if (!spend_money(total_cost)) return {};
+
+    size_t counter = is_convoy ? ShipIDGenerator::get_convoy_counter() : ShipIDGenerator::get_pirate_counter();
+    auto rollback = [&]() {
+        if (is_convoy) ShipIDGenerator::set_convoy_counter(counter);
+        else ShipIDGenerator::set_pirate_counter(counter);
+        add_money(total_cost);
+    };
+
+    std::vector<std::string> ids;
+    try {
+        std::vector<std::unique_ptr<IShip>> ships = ship_catalog_.create_ships(template_id, positions.size(), is_convoy);
+        if (ships.size() != positions.size()) {
+            rollback();
+            return {};
+        }
+        ids.reserve(ships.size());
+        for (size_t i = 0; i < ships.size(); ++i) {
+            ships[i]->set_position(positions[i]);
+            ids.push_back(ships[i]->get_ID());
+        }
+        if (is_convoy) convoy_repo_.create_batch(std::move(ships));
+        else pirate_repo_.create_batch(std::move(ships));
+    }
+    catch (const std::exception& e) {
+        rollback();
+        return {};
+    }
+    mission_.touch();
+    return ids;
+}
+
 double PurchaseService::sell_ship(const std::string& ship_id) {
     IShip* ship = find_ship(ship_id);
     if (!ship) return 0.0;
@@ -79,6 +119,7 @@ double PurchaseService::sell_ship(IShip* ship) {
         return 0.0;
     }
     
+    mission_.touch();
     return refund;
 }
 
@@ -119,8 +160,9 @@ bool PurchaseService::install_weapon(const std::string& ship_id, PlaceForWeapon
     
     WeaponInstallationVisitor visitor(place, std::move(weapon));
     ship->accept(&visitor);
-    if (visitor.is_installed()) return true;
-    else return false;
+    if (!visitor.is_installed()) return false;
+    mission_.touch();
+    return true;
 }
 
 bool PurchaseService::install_weapon(const std::string& ship_id, PlaceForWeapon place, std::unique_ptr<IWeapon> weapon) {
@@ -132,8 +174,45 @@ bool PurchaseService::install_weapon(const std::string& ship_id, PlaceForWeapon
     WeaponInstallationVisitor visitor(place, std::move(weapon));
     ship->accept(&visitor);
     
-    if (visitor.is_installed()) return true;
-    else return false;
+    if (!visitor.is_installed()) return false;
+    mission_.touch();
+    return true;
+}
+
+bool PurchaseService::install_weapons(const std::vector<std::string>& ship_ids, PlaceForWeapon place, const std::string& weapon_template_id) {
+    const WeaponTemplate* temp = weapon_catalog_.find_template_by_id(weapon_template_id);
+    if (!temp || ship_ids.empty()) return false;
+
+    std::vector<DefaultGuard*> guards;
+    std::unordered_set<DefaultGuard*> seen;
+    guards.reserve(ship_ids.size());
+    seen.reserve(ship_ids.size());
+    for (const auto& ship_id : ship_ids) {
+        DefaultGuard* guard = dynamic_cast<DefaultGuard*>(find_ship(ship_id));
+        if (!guard || guard->has_weapon_in_place(place)) return false;
+        if (!seen.insert(guard).second) return false;
+        guards.push_back(guard);
+    }
+
+    double total_cost = temp->cost * guards.size();
+    if (!spend_money(total_cost)) return false;
+
+    std::vector<std::unique_ptr<IWeapon>> weapons;
+    try {
+        weapons = weapon_catalog_.create_weapons(weapon_template_id, guards.size());
+    }
+    catch (const std::exception& e) {
+        add_money(total_cost);
+        return false;
+    }
+    if (weapons.size() != guards.size()) {
+        add_money(total_cost);
+        return false;
+    }
+
+    for (size_t i = 0; i < guards.size(); ++i) guards[i]->set_weapon_in_place(place, std::move(weapons[i]));
+    mission_.touch();
+    return true;
 }
 
 double PurchaseService::sell_weapon(const std::string& ship_id, PlaceForWeapon place) {
@@ -143,6 +222,7 @@ double PurchaseService::sell_weapon(const std::string& ship_id, PlaceForWeapon p
     WeaponRemovalVisitor visitor(place);
     ship->accept(&visitor);   
     if (visitor.is_removed()) {
+        mission_.touch();
         double refund = visitor.get_weapon_cost();
         if (add_money(refund)) return refund;
     }
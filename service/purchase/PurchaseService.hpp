@@ -64,6 +64,17 @@ class PurchaseService {
          * @return bool true если покупка успешна, false в противном случае
          */
         bool buy_ship(const std::string& template_id, bool is_convoy = true, const Vector& position = Vector(0, 0));
+
+        /**
+         * @brief Покупает пачку кораблей одного шаблона (все или ни одного)
+         * @details Бюджет проверяется и списывается один раз на всю пачку, корабли создаются одним резервированием
+         * и добавляются в репозиторий пакетно. При любой ошибке деньги возвращаются, а счетчик идентификаторов откатывается.
+         * @param template_id Идентификатор шаблона корабля
+         * @param positions Позиции кораблей (по одной на корабль)
+         * @param is_convoy true если корабли для конвоя, false для пиратов (по умолчанию true)
+         * @return std::vector<std::string> Идентификаторы купленных кораблей или пустой вектор, если покупка не удалась
+         */
+        std::vector<std::string> buy_ships(const std::string& template_id, const std::vector<Vector>& positions, bool is_convoy = true);
         
         /**
          * @brief Продает корабль по идентификатору
@@ -104,6 +115,17 @@ class PurchaseService {
          */
         bool install_weapon(const std::string& ship_id, PlaceForWeapon place, std::unique_ptr<IWeapon> weapon);
 
+        /**
+         * @brief Устанавливает оружие одного шаблона на несколько кораблей (на все или ни на один)
+         * @details Сначала проверяются все корабли и место установки, затем бюджет списывается один раз на всю пачку.
+         * Если создание оружия не удалось, деньги возвращаются и ни один корабль не изменяется.
+         * @param ship_ids Идентификаторы кораблей
+         * @param place Место установки оружия
+         * @param weapon_template_id Идентификатор шаблона оружия
+         * @return bool true если оружие установлено на все корабли, false в противном случае
+         */
+        bool install_weapons(const std::vector<std::string>& ship_ids, PlaceForWeapon place, const std::string& weapon_template_id);
+
         /**
          * @brief Продает оружие с корабля
          * @param ship_id Идентификатор корабля
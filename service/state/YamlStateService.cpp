@@ -1,7 +1,10 @@
 #include "YamlStateService.hpp"
+#include "../../auxiliary/Tracer.hpp"
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <thread>
+#include <algorithm>
 #include "../../entity/ship/Concrete/WarShip.hpp"
 #include "../../entity/ship/Concrete/TransportShip.hpp"
 
@@ -117,6 +120,57 @@ YAML::Node YamlStateService::serialize_ship_dto(const ShipDTO& ship_dto) const {
     return node;
 }
 
+YAML::Node YamlStateService::serialize_snapshot_ship(const FleetSnapshot& snapshot, size_t index) const {
+    YAML::Node node;
+    node["type"] = std::string(snapshot.str(snapshot.type[index]));
+    node["id"] = std::string(snapshot.str(snapshot.id[index]));
+    node["name"] = std::string(snapshot.str(snapshot.name[index]));
+    YAML::Node captain;
+    captain["fio"] = std::string(snapshot.str(snapshot.captain_fio[index]));
+    captain["rank"] = std::string(snapshot.str(snapshot.captain_rank[index]));
+    node["captain"] = captain;
+    node["max_speed"] = snapshot.max_speed[index];
+    node["current_speed"] = snapshot.current_speed[index];
+    node["cost"] = snapshot.cost[index];
+    node["position"] = serialize_vector(Vector(snapshot.position_x[index], snapshot.position_y[index]));
+    node["max_health"] = snapshot.max_health[index];
+    node["current_health"] = snapshot.current_health[index];
+    node["is_alive"] = static_cast<bool>(snapshot.is_alive[index]);
+    node["is_convoy"] = static_cast<bool>(snapshot.is_convoy[index]);
+
+    if (snapshot.max_cargo[index] > 0) {
+        node["max_cargo"] = snapshot.max_cargo[index];
+        node["current_cargo"] = snapshot.current_cargo[index];
+        node["speed_reduction_factor"] = snapshot.speed_reduction_factor[index];
+    }
+
+    if (snapshot.weapon_begin[index] != snapshot.weapon_begin[index + 1]) {
+        YAML::Node weapons_node;
+        for (uint32_t i = snapshot.weapon_begin[index]; i < snapshot.weapon_begin[index + 1]; ++i) {
+            const FleetWeaponRow& row = snapshot.weapons[i];
+            YAML::Node weapon_node;
+            weapon_node["type"] = std::string(snapshot.str(row.type));
+            weapon_node["name"] = std::string(snapshot.str(row.name));
+            weapon_node["damage"] = row.damage;
+            weapon_node["range"] = row.range;
+            weapon_node["fire_rate"] = row.fire_rate;
+            weapon_node["max_ammo"] = row.max_ammo;
+            weapon_node["current_ammo"] = row.current_ammo;
+            weapon_node["cost"] = row.cost;
+            weapon_node["accuracy"] = row.accuracy;
+            weapon_node["explosion_radius"] = row.explosion_radius;
+
+            YAML::Node weapon_entry;
+            weapon_entry["place"] = serialize_place_for_weapon(row.place);
+            weapon_entry["weapon"] = weapon_node;
+            weapons_node.push_back(weapon_entry);
+        }
+        node["weapons"] = weapons_node;
+    }
+
+    return node;
+}
+
 ShipDTO YamlStateService::deserialize_ship_dto(const YAML::Node& node) const {
     ShipDTO ship_dto;
     ship_dto.type = node["type"].as<std::string>();
@@ -243,31 +297,73 @@ MissionDTO YamlStateService::deserialize_mission_dto(const YAML::Node& node) con
 }
 
 void YamlStateService::save_ships_to_yaml(IShipRepository* repository, YAML::Node& parent_node, const std::string& node_name) {
+    TRACE_SPAN("state", "YamlStateService::save_ships_to_yaml");
     if (!repository) throw std::invalid_argument("Repository cannot be null");
 
     YAML::Node ships_node;
-    auto all_ships = repository->read_all();
-    
-    for (const auto& ship : all_ships) {
-        if (ship) {
-            auto ship_dto = ship_dto_mapper_manager_.create_ship_dto(ship.get());
-            ships_node.push_back(serialize_ship_dto(ship_dto));
-        }
+    FleetSnapshot snapshot = fleet_snapshot_mapper_.transform(repository->get_all_ship_ptrs());
+    for (size_t i = 0; i < snapshot.size(); ++i) {
+        ships_node.push_back(serialize_snapshot_ship(snapshot, i));
     }
     
     parent_node[node_name] = ships_node;
 }
 
+std::vector<std::unique_ptr<IShip>> YamlStateService::decode_ships_parallel(const std::vector<YAML::Node>& ship_nodes, bool is_convoy, std::vector<std::string>& errors) const {
+    TRACE_SPAN("state", "YamlStateService::decode_ships_parallel");
+    std::vector<std::unique_ptr<IShip>> ships(ship_nodes.size());
+    errors.assign(ship_nodes.size(), std::string());
+
+    auto decode_range = [this, &ship_nodes, &ships, &errors, is_convoy](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            try {
+                ShipDTO ship_dto = deserialize_ship_dto(ship_nodes[i]);
+                ship_dto.is_convoy = is_convoy;
+                ships[i] = ship_mapper_manager_.create_ship(ship_dto);
+            }
+            catch (const std::exception& e) {
+                errors[i] = e.what();
+            }
+        }
+    };
+
+    size_t thread_count = std::max<size_t>(1, std::thread::hardware_concurrency());
+    thread_count = std::min(thread_count, ship_nodes.size());
+    if (thread_count <= 1) {
+        decode_range(0, ship_nodes.size());
+        return ships;
+    }
+
+    size_t chunk_size = (ship_nodes.size() + thread_count - 1) / thread_count;
+    std::vector<std::jthread> threads;
+    threads.reserve(thread_count);
+    for (size_t start = 0; start < ship_nodes.size(); start += chunk_size) {
+        size_t end = std::min(start + chunk_size, ship_nodes.size());
+        threads.emplace_back(decode_range, start, end);
+    }
+
+    return ships;
+}
+
 void YamlStateService::load_ships_from_yaml(IShipRepository* repository, const YAML::Node& ships_node, bool is_convoy) {
+    TRACE_SPAN("state", "YamlStateService::load_ships_from_yaml");
     if (!repository) throw std::invalid_argument("Repository cannot be null");
-    
-    for (const auto& ship_node : ships_node) {
+
+    std::vector<YAML::Node> ship_nodes;
+    ship_nodes.reserve(ships_node.size());
+    for (const auto& ship_node : ships_node) ship_nodes.push_back(ship_node);
+
+    std::vector<std::string> errors;
+    std::vector<std::unique_ptr<IShip>> ships = decode_ships_parallel(ship_nodes, is_convoy, errors);
+
+    repository->reserve(repository->count() + ships.size());
+    for (size_t i = 0; i < ships.size(); ++i) {
+        if (!errors[i].empty()) {
+            std::cerr << "Error loading ship: " << errors[i] << std::endl;
+            continue;
+        }
         try {
-            ShipDTO ship_dto = deserialize_ship_dto(ship_node);
-            ship_dto.is_convoy = is_convoy;
-            
-            auto ship = ship_mapper_manager_.create_ship(ship_dto);
-            if (ship) repository->create(std::move(ship));
+            if (ships[i]) repository->create(std::move(ships[i]));
         }
         catch (const std::exception& e) {
             std::cerr << "Error loading ship: " << e.what() << std::endl;
@@ -294,6 +390,7 @@ YamlStateService::YamlStateService(
 YamlStateService::~YamlStateService() = default;
 
 bool YamlStateService::save(const std::string& path) {
+    TRACE_SPAN("state", "YamlStateService::save");
     try {
         YAML::Node root;
         
@@ -317,18 +414,19 @@ bool YamlStateService::save(const std::string& path) {
 }
 
 bool YamlStateService::load(const std::string& path) {
+    TRACE_SPAN("state", "YamlStateService::load");
     try {
         YAML::Node root = YAML::LoadFile(path);
         if (!root["mission"]) throw std::runtime_error("Invalid save file: missing mission section");
         
         MissionDTO mission_dto = deserialize_mission_dto(root["mission"]);
         auto mission = mission_mapper_.transform(mission_dto);
-        mission_ = *mission;
-        
         if (!mission) throw std::runtime_error("Failed to create mission from DTO");
         
+        mission_ = *mission;
         if (root["convoy_ships"]) load_ships_from_yaml(&convoy_repo_, root["convoy_ships"], true);
         if (root["pirate_ships"]) load_ships_from_yaml(&pirate_repo_, root["pirate_ships"], false);
+        mission_.touch();
         
         return true;
     }
@@ -339,6 +437,7 @@ bool YamlStateService::load(const std::string& path) {
 }
 
 bool YamlStateService::load_mission(const std::string& path) {
+    TRACE_SPAN("state", "YamlStateService::load_mission");
     try {
         YAML::Node root = YAML::LoadFile(path);
         if (!root["mission"]) throw std::runtime_error("Invalid mission file: missing mission section");
@@ -17,6 +17,7 @@
 #include "../../mapper/pirate_base/ToDTO/PirateBaseDTOMapper.hpp"
 #include "../../mapper/ship/Managers/ShipDTOMapperManager.hpp"
 #include "../../mapper/ship/Managers/ShipMapperManager.hpp"
+#include "../../mapper/ship/ToDTO/FleetSnapshotMapper.hpp"
 #include "../../mapper/weapon/Managers/WeaponDTOMapperManager.hpp"
 #include "../../mapper/weapon/Managers/WeaponMapperManager.hpp"
 
@@ -34,6 +35,7 @@ class YamlStateService : public IStateService {
         MissionMapper& mission_mapper_; ///< Ссылка на маппер миссии
         ShipDTOMapperManager& ship_dto_mapper_manager_; ///< Ссылка на менеджер мапперов кораблей DTO
         ShipMapperManager& ship_mapper_manager_; ///< Ссылка на менеджер мапперов кораблей
+        FleetSnapshotMapper fleet_snapshot_mapper_; ///< Маппер кораблей в колоночный снимок
 
         /**
          * @brief Сериализует вектор в YAML-узел
@@ -104,6 +106,14 @@ class YamlStateService : public IStateService {
          * @return ShipDTO DTO корабля
          */
         ShipDTO deserialize_ship_dto(const YAML::Node& node) const;
+
+        /**
+         * @brief Сериализует корабль из колоночного снимка в YAML-узел (в том же формате, что и serialize_ship_dto)
+         * @param snapshot Снимок кораблей
+         * @param index Индекс корабля в снимке
+         * @return YAML::Node YAML-узел с данными корабля
+         */
+        YAML::Node serialize_snapshot_ship(const FleetSnapshot& snapshot, size_t index) const;
         
         /**
          * @brief Сериализует DTO пиратской базы в YAML-узел
@@ -141,6 +151,15 @@ class YamlStateService : public IStateService {
          */
         void save_ships_to_yaml(IShipRepository* repository, YAML::Node& parent_node, const std::string& node_name);
         
+        /**
+         * @brief Декодирует узлы кораблей в объекты кораблей на пуле рабочих потоков
+         * @param ship_nodes YAML-узлы кораблей
+         * @param is_convoy true если корабли конвоя, false если пираты
+         * @param errors Сообщения об ошибках для каждого узла (пустая строка, если узел декодирован успешно)
+         * @return std::vector<std::unique_ptr<IShip>> Корабли в порядке узлов (nullptr для узлов с ошибкой)
+         */
+        std::vector<std::unique_ptr<IShip>> decode_ships_parallel(const std::vector<YAML::Node>& ship_nodes, bool is_convoy, std::vector<std::string>& errors) const;
+
         /**
          * @brief Загружает корабли из YAML-узла
          * @param repository Репозиторий кораблей
@@ -0,0 +1,26 @@
+/**
+ * @file DenseEnum.hpp
+ * @brief Заголовочный файл, содержащий описание перечислений с плотными значениями ключей
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * @struct dense_enum_size
+ * @brief Количество значений перечисления, принимающего значения 0, 1, ..., size - 1
+ * @details По умолчанию 0 (перечисление не считается плотным). Специализируется рядом с объявлением перечисления.
+ * @tparam Key Тип перечисления
+ */
+template <typename Key>
+struct dense_enum_size : std::integral_constant<size_t, 0> {};
+
+/**
+ * @concept DenseEnumKey
+ * @brief Перечисление с небольшим количеством плотных значений, пригодное для прямой индексации
+ * @tparam Key Тип ключа
+ */
+template <typename Key>
+concept DenseEnumKey = std::is_enum_v<Key> && (dense_enum_size<Key>::value > 0) && (dense_enum_size<Key>::value <= 32);
@@ -0,0 +1,536 @@
+/**
+ * @file DenseLookupTable.hpp
+ * @brief Заголовочный файл, содержащий специализацию LookupTable для плотных enum-ключей
+ */
+
+#pragma once
+
+#include "DenseEnum.hpp"
+#include "DenseTableIterator.hpp"
+#include "TableMemoryUsage.hpp"
+#include <concepts>
+#include <stdexcept>
+#include <memory>
+#include <new>
+#include <cstdint>
+#include <bit>
+#include <initializer_list>
+
+/**
+ * @class LookupTable
+ * @brief Специализация просматриваемой таблицы для плотных enum-ключей
+ * @details Значения хранятся в массиве фиксированного размера внутри объекта, индексом служит значение ключа,
+ * занятость ячеек задается битовой маской. Поиск, вставка и удаление выполняются за O(1) без выделения памяти.
+ * @tparam Key Тип ключа (перечисление, для которого специализирован dense_enum_size)
+ * @tparam T Тип значения
+ */
+template <typename Key, typename T> requires DenseEnumKey<Key>
+class LookupTable<Key, T> {
+    public:
+        static constexpr size_t key_count = dense_enum_size<Key>::value; ///< Количество возможных ключей
+
+        using key_type = Key; ///< Тип ключа
+        using mapped_type = T; ///< Тип значения
+        using value_type = std::pair<const Key, T>; ///< Тип элемента
+        using reference = value_type&; ///< Тип ссылки на элемент
+        using const_reference = const value_type&; ///< Тип константной ссылки на элемент
+        using iterator = DenseTableIterator<Key, T, false>; ///< Тип итератора
+        using const_iterator = DenseTableIterator<Key, T, true>; ///< Тип константного итератора
+        using difference_type = ptrdiff_t; ///< Тип разницы итераторов
+        using size_type = size_t; ///< Тип размера
+
+    private:
+        friend class DenseTableIterator<Key, T, false>;
+        friend class DenseTableIterator<Key, T, true>;
+
+        /**
+         * @brief Ячейка таблицы (неинициализированное хранилище элемента)
+         */
+        struct Slot {
+            alignas(value_type) std::byte storage[sizeof(value_type)]; ///< Хранилище элемента
+        };
+
+        Slot slots_[key_count]; ///< Ячейки таблицы, индексируемые значением ключа
+        uint32_t mask_ = 0; ///< Битовая маска занятых ячеек
+
+        /**
+         * @brief Переводит ключ в индекс ячейки
+         * @param key Ключ
+         * @return size_t Индекс ячейки или key_count, если ключ вне диапазона
+         */
+        static size_t index_of(const Key& key) noexcept {
+            size_t index = static_cast<size_t>(key);
+            return index < key_count ? index : key_count;
+        }
+
+        /**
+         * @brief Проверяет, занята ли ячейка
+         * @param index Индекс ячейки
+         * @return bool true если ячейка занята, false в противном случае
+         */
+        bool occupied(size_t index) const noexcept {
+            return index < key_count && (mask_ >> index) & 1u;
+        }
+
+        /**
+         * @brief Получает элемент занятой ячейки
+         * @param index Индекс ячейки
+         * @return value_type& Ссылка на элемент
+         */
+        value_type& slot(size_t index) noexcept {
+            return *std::launder(reinterpret_cast<value_type*>(slots_[index].storage));
+        }
+
+        /**
+         * @brief Получает элемент занятой ячейки (константная версия)
+         * @param index Индекс ячейки
+         * @return const value_type& Константная ссылка на элемент
+         */
+        const value_type& slot(size_t index) const noexcept {
+            return *std::launder(reinterpret_cast<const value_type*>(slots_[index].storage));
+        }
+
+        /**
+         * @brief Уничтожает элемент в ячейке и помечает ее свободной
+         * @param index Индекс занятой ячейки
+         */
+        void destroy(size_t index) noexcept {
+            slot(index).~value_type();
+            mask_ &= ~(1u << index);
+        }
+
+        /**
+         * @brief Проверяет равенство значений (для указателей сравниваются объекты)
+         * @param lhs Первое значение
+         * @param rhs Второе значение
+         * @return bool true если значения равны, false в противном случае
+         */
+        static bool values_equal(const T& lhs, const T& rhs) {
+            if constexpr (requires { *lhs; lhs.get(); }) {
+                if (!lhs || !rhs) return !lhs && !rhs;
+                return *lhs == *rhs;
+            }
+            else return lhs == rhs;
+        }
+
+    public:
+        /**
+         * @brief Получает итератор на начало таблицы
+         * @return iterator Итератор на первый элемент
+         */
+        iterator begin() noexcept {
+            return iterator(this, 0);
+        }
+
+        /**
+         * @brief Получает итератор на конец таблицы
+         * @return iterator Итератор на позицию после последнего элемента
+         */
+        iterator end() noexcept {
+            return iterator(this, key_count);
+        }
+
+        /**
+         * @brief Получает константный итератор на начало таблицы
+         * @return const_iterator Константный итератор на первый элемент
+         */
+        const_iterator begin() const noexcept {
+            return const_iterator(this, 0);
+        }
+
+        /**
+         * @brief Получает константный итератор на конец таблицы
+         * @return const_iterator Константный итератор на позицию после последнего элемента
+         */
+        const_iterator end() const noexcept {
+            return const_iterator(this, key_count);
+        }
+
+        /**
+         * @brief Получает константный итератор на начало таблицы
+         * @return const_iterator Константный итератор на первый элемент
+         */
+        const_iterator cbegin() const noexcept {
+            return const_iterator(this, 0);
+        }
+
+        /**
+         * @brief Получает константный итератор на конец таблицы
+         * @return const_iterator Константный итератор на позицию после последнего элемента
+         */
+        const_iterator cend() const noexcept {
+            return const_iterator(this, key_count);
+        }
+
+        /**
+         * @brief Конструктор по умолчанию
+         */
+        LookupTable() noexcept = default;
+
+        /**
+         * @brief Конструктор копирования
+         * @param other Другой объект LookupTable
+         * @requires std::copy_constructible<T>
+         */
+        LookupTable(const LookupTable& other) requires std::copy_constructible<T> : LookupTable() {
+            for (size_t i = 0; i < key_count; ++i) {
+                if (other.occupied(i)) {
+                    ::new (slots_[i].storage) value_type(other.slot(i));
+                    mask_ |= 1u << i;
+                }
+            }
+        }
+
+        /**
+         * @brief Конструктор перемещения
+         * @param other Другой объект LookupTable
+         */
+        LookupTable(LookupTable&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : LookupTable() {
+            for (size_t i = 0; i < key_count; ++i) {
+                if (other.occupied(i)) {
+                    ::new (slots_[i].storage) value_type(std::move(other.slot(i)));
+                    mask_ |= 1u << i;
+                }
+            }
+            other.clear();
+        }
+
+        /**
+         * @brief Конструктор из диапазона итераторов
+         * @tparam It Тип итератора
+         * @param first Начало диапазона
+         * @param last Конец диапазона
+         */
+        template<std::input_iterator It>
+        LookupTable(It first, It last) : LookupTable() {
+            insert(first, last);
+        }
+
+        /**
+         * @brief Конструктор из списка инициализации
+         * @param il Список инициализации
+         * @requires std::copy_constructible<T>
+         */
+        LookupTable(std::initializer_list<value_type> il) requires std::copy_constructible<T> : LookupTable() {
+            for (const auto& [key, value] : il) {
+                insert(key, value);
+            }
+        }
+
+        /**
+         * @brief Деструктор
+         */
+        ~LookupTable() {
+            clear();
+        }
+
+        /**
+         * @brief Получает количество элементов в таблице
+         * @return size_type Количество элементов
+         */
+        size_type size() const noexcept {
+            return static_cast<size_type>(std::popcount(mask_));
+        }
+
+        /**
+         * @brief Получает максимально возможный размер таблицы
+         * @return size_type Максимальный размер (количество возможных ключей)
+         */
+        size_type max_size() const noexcept {
+            return key_count;
+        }
+
+        /**
+         * @brief Проверяет, пуста ли таблица
+         * @return bool true если таблица пуста, false в противном случае
+         */
+        bool empty() const noexcept {
+            return mask_ == 0;
+        }
+
+        /**
+         * @brief Очищает таблицу
+         */
+        void clear() noexcept {
+            for (size_t i = 0; i < key_count; ++i) {
+                if (occupied(i)) destroy(i);
+            }
+        }
+
+        /**
+         * @brief Обменивает содержимое с другой таблицей
+         * @param other Другая таблица
+         */
+        void swap(LookupTable& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            LookupTable temp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(temp);
+        }
+
+        /**
+         * @brief Резервирует память (все ячейки уже размещены внутри объекта, поэтому ничего не делает)
+         * @param capacity Требуемая вместимость
+         */
+        void reserve(size_type capacity) noexcept {}
+
+        /**
+         * @brief Получает сведения о памяти, занятой ячейками
+         * @details Ячейки размещены внутри объекта таблицы, удаленных ячеек не бывает
+         * @return TableMemoryUsage Размер ячейки, количество элементов и пустых ячеек, вместимость
+         */
+        TableMemoryUsage memory_usage() const noexcept {
+            return {sizeof(Slot), sizeof(value_type), size(), 0, key_count - size(), key_count};
+        }
+
+        /**
+         * @brief Освобождает неиспользуемую память (ячейки размещены внутри объекта, поэтому ничего не делает)
+         */
+        void shrink_to_fit() noexcept {}
+
+        /**
+         * @brief Создает элемент на месте
+         * @tparam Args Типы аргументов для создания значения
+         * @param key Ключ элемента
+         * @param args Аргументы для создания значения
+         * @return std::pair<iterator, bool> Пара: итератор на элемент и флаг успешного создания
+         * @throw std::out_of_range Если значение ключа вне диапазона перечисления
+         */
+        template <typename... Args>
+        std::pair<iterator, bool> emplace(const Key& key, Args&&... args) requires std::constructible_from<T, Args...> {
+            size_t index = index_of(key);
+            if (index == key_count) throw std::out_of_range("Key out of range");
+            if (occupied(index)) return {iterator(this, index), false};
+
+            ::new (slots_[index].storage) value_type(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+            mask_ |= 1u << index;
+            return {iterator(this, index), true};
+        }
+
+        /**
+         * @brief Вставляет элемент (копирование)
+         * @param value Элемент для вставки
+         * @return std::pair<iterator, bool> Пара: итератор на элемент и флаг успешной вставки
+         */
+        std::pair<iterator, bool> insert(const value_type& value) requires std::copy_constructible<T> {
+            return emplace(value.first, value.second);
+        }
+
+        /**
+         * @brief Вставляет элемент (перемещение)
+         * @param value Элемент для вставки
+         * @return std::pair<iterator, bool> Пара: итератор на элемент и флаг успешной вставки
+         */
+        std::pair<iterator, bool> insert(value_type&& value) requires std::move_constructible<T> {
+            return emplace(value.first, std::move(value.second));
+        }
+
+        /**
+         * @brief Вставляет элемент по ключу и значению (копирование)
+         * @param key Ключ элемента
+         * @param value Значение элемента
+         * @return std::pair<iterator, bool> Пара: итератор на элемент и флаг успешной вставки
+         */
+        std::pair<iterator, bool> insert(const Key& key, const T& value) requires std::copy_constructible<T> {
+            return emplace(key, value);
+        }
+
+        /**
+         * @brief Вставляет элемент по ключу и значению (перемещение)
+         * @param key Ключ элемента
+         * @param value Значение элемента
+         * @return std::pair<iterator, bool> Пара: итератор на элемент и флаг успешной вставки
+         */
+        std::pair<iterator, bool> insert(const Key& key, T&& value) requires std::move_constructible<T> {
+            return emplace(key, std::move(value));
+        }
+
+        /**
+         * @brief Вставляет элементы из диапазона итераторов
+         * @tparam It Тип итератора
+         * @param first Начало диапазона
+         * @param last Конец диапазона
+         */
+        template<std::input_iterator It>
+        void insert(It first, It last) {
+            for (; first != last; ++first) {
+                if constexpr (std::copy_constructible<T>) emplace(first->first, first->second);
+                else emplace(first->first, std::move(first->second));
+            }
+        }
+
+        /**
+         * @brief Вставляет элементы из списка инициализации
+         * @param il Список инициализации
+         */
+        void insert(std::initializer_list<value_type> il) requires std::copy_constructible<T> {
+            for (const auto& pair : il) {
+                emplace(pair.first, pair.second);
+            }
+        }
+
+        /**
+         * @brief Удаляет элемент по ключу
+         * @param key Ключ элемента для удаления
+         * @return size_type Количество удаленных элементов (0 или 1)
+         */
+        size_type erase(const Key& key) noexcept {
+            size_t index = index_of(key);
+            if (!occupied(index)) return 0;
+            destroy(index);
+            return 1;
+        }
+
+        /**
+         * @brief Удаляет элемент по итератору
+         * @param p Итератор на элемент для удаления
+         * @return iterator Итератор на следующий элемент
+         */
+        iterator erase(const_iterator p) noexcept {
+            if (p.table_ != this || !occupied(p.index_)) return end();
+            destroy(p.index_);
+            return iterator(this, p.index_ + 1);
+        }
+
+        /**
+         * @brief Удаляет диапазон элементов
+         * @param first Начало диапазона
+         * @param last Конец диапазона
+         * @return iterator Итератор на элемент после удаленного диапазона
+         */
+        iterator erase(const_iterator first, const_iterator last) noexcept {
+            for (size_t i = first.index_; i < last.index_ && i < key_count; ++i) {
+                if (occupied(i)) destroy(i);
+            }
+            return iterator(this, last.index_);
+        }
+
+        /**
+         * @brief Считает количество элементов с заданным ключом
+         * @param key Ключ для поиска
+         * @return size_type Количество элементов (0 или 1)
+         */
+        size_type count(const Key& key) const noexcept {
+            return occupied(index_of(key)) ? 1 : 0;
+        }
+
+        /**
+         * @brief Находит элемент по ключу
+         * @param key Ключ для поиска
+         * @return iterator Итератор на найденный элемент или end()
+         */
+        iterator find(const Key& key) noexcept {
+            size_t index = index_of(key);
+            return occupied(index) ? iterator(this, index) : end();
+        }
+
+        /**
+         * @brief Находит элемент по ключу (константная версия)
+         * @param key Ключ для поиска
+         * @return const_iterator Константный итератор на найденный элемент или end()
+         */
+        const_iterator find(const Key& key) const noexcept {
+            size_t index = index_of(key);
+            return occupied(index) ? const_iterator(this, index) : end();
+        }
+
+        /**
+         * @brief Проверяет наличие элемента с заданным ключом
+         * @param key Ключ для проверки
+         * @return bool true если элемент существует, false в противном случае
+         */
+        bool contains(const Key& key) const noexcept {
+            return occupied(index_of(key));
+        }
+
+        /**
+         * @brief Оператор копирующего присваивания
+         * @param other Другой объект LookupTable
+         * @return LookupTable& Ссылка на текущий объект
+         */
+        LookupTable& operator=(const LookupTable& other) requires std::copy_constructible<T> {
+            if (this != &other) {
+                LookupTable temp(other);
+                clear();
+                *this = std::move(temp);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Оператор перемещающего присваивания
+         * @param other Другой объект LookupTable
+         * @return LookupTable& Ссылка на текущий объект
+         */
+        LookupTable& operator=(LookupTable&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            if (this != &other) {
+                clear();
+                for (size_t i = 0; i < key_count; ++i) {
+                    if (other.occupied(i)) {
+                        ::new (slots_[i].storage) value_type(std::move(other.slot(i)));
+                        mask_ |= 1u << i;
+                    }
+                }
+                other.clear();
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Оператор присваивания из списка инициализации
+         * @param il Список инициализации
+         * @return LookupTable& Ссылка на текущий объект
+         */
+        LookupTable& operator=(std::initializer_list<value_type> il) requires std::copy_constructible<T> {
+            clear();
+            insert(il);
+            return *this;
+        }
+
+        /**
+         * @brief Оператор сравнения на равенство
+         * @param other Другой объект LookupTable
+         * @return bool true если таблицы равны, false в противном случае
+         */
+        bool operator==(const LookupTable& other) const {
+            if (mask_ != other.mask_) return false;
+            for (size_t i = 0; i < key_count; ++i) {
+                if (occupied(i) && !values_equal(slot(i).second, other.slot(i).second)) return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Оператор доступа к элементу (создает элемент если не существует)
+         * @param key Ключ элемента
+         * @return T& Ссылка на значение элемента
+         */
+        T& operator[](const Key& key) {
+            size_t index = index_of(key);
+            if (occupied(index)) return slot(index).second;
+            return emplace(key).first->second;
+        }
+
+        /**
+         * @brief Доступ к элементу с проверкой границ
+         * @param key Ключ элемента
+         * @return T& Ссылка на значение элемента
+         * @throw std::out_of_range Если элемент не найден
+         */
+        T& at(const Key& key) {
+            size_t index = index_of(key);
+            if (!occupied(index)) throw std::out_of_range("Key not found");
+            return slot(index).second;
+        }
+
+        /**
+         * @brief Доступ к элементу с проверкой границ (константная версия)
+         * @param key Ключ элемента
+         * @return const T& Константная ссылка на значение элемента
+         * @throw std::out_of_range Если элемент не найден
+         */
+        const T& at(const Key& key) const {
+            size_t index = index_of(key);
+            if (!occupied(index)) throw std::out_of_range("Key not found");
+            return slot(index).second;
+        }
+};
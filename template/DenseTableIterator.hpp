@@ -0,0 +1,199 @@
+/**
+ * @file DenseTableIterator.hpp
+ * @brief Заголовочный файл, содержащий определение класса итератора для LookupTable с плотными enum-ключами
+ */
+
+#pragma once
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+
+template<typename Key, typename T>
+class LookupTable;
+
+/**
+ * @class DenseTableIterator
+ * @brief Итератор для LookupTable с плотными enum-ключами, проходящий только по занятым ячейкам
+ * @tparam Key Тип ключа
+ * @tparam T Тип значения
+ * @tparam IsConst Флаг константности итератора
+ */
+template<typename Key, typename T, bool IsConst>
+class DenseTableIterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag; ///< Категория итератора
+        using value_type = std::pair<const Key, T>; ///< Тип значения
+        using difference_type = std::ptrdiff_t; ///< Тип разницы
+        using pointer = std::conditional_t<IsConst, const std::pair<const Key, T>, std::pair<const Key, T>>*; ///< Тип указателя
+        using reference = std::conditional_t<IsConst, const std::pair<const Key, T>, std::pair<const Key, T>>&; ///< Тип ссылки
+
+    private:
+        friend class LookupTable<Key, T>;
+        friend class DenseTableIterator<Key, T, !IsConst>;
+
+        using TableType = std::conditional_t<IsConst, const LookupTable<Key, T>, LookupTable<Key, T>>*; ///< Тип таблицы
+        TableType table_; ///< Таблица, по которой идет обход
+        size_t index_; ///< Индекс текущей ячейки
+
+        /**
+         * @brief Конструктор
+         * @param table Указатель на таблицу
+         * @param index Индекс ячейки
+         */
+        DenseTableIterator(TableType table, size_t index) : table_(table), index_(index) {
+            skip_empty_forward();
+        }
+
+        /**
+         * @brief Пропускает пустые ячейки при движении вперед
+         */
+        void skip_empty_forward() {
+            while (index_ < LookupTable<Key, T>::key_count && !table_->occupied(index_)) ++index_;
+        }
+
+        /**
+         * @brief Пропускает пустые ячейки при движении назад
+         */
+        void skip_empty_backward() {
+            while (index_ > 0 && !table_->occupied(index_)) --index_;
+        }
+    public:
+        /**
+         * @brief Конструктор по умолчанию
+         */
+        DenseTableIterator() noexcept : table_(nullptr), index_(0) {}
+
+        /**
+         * @brief Конструктор преобразования из другого итератора
+         * @tparam OtherConst Флаг константности другого итератора
+         * @param other Другой итератор
+         */
+        template<bool OtherConst>
+        DenseTableIterator(const DenseTableIterator<Key, T, OtherConst>& other) noexcept requires (IsConst >= OtherConst) : table_(other.table_), index_(other.index_) {}
+
+        /**
+         * @brief Оператор присваивания из другого итератора
+         * @tparam OtherConst Флаг константности другого итератора
+         * @param other Другой итератор
+         * @return DenseTableIterator& Ссылка на текущий итератор
+         */
+        template<bool OtherConst>
+        DenseTableIterator& operator=(const DenseTableIterator<Key, T, OtherConst>& other) noexcept requires (IsConst >= OtherConst) {
+            table_ = other.table_;
+            index_ = other.index_;
+            return *this;
+        }
+
+        /**
+         * @brief Оператор разыменования
+         * @return reference Ссылка на текущий элемент
+         */
+        reference operator*() const noexcept {
+            return table_->slot(index_);
+        }
+
+        /**
+         * @brief Оператор доступа к члену
+         * @return pointer Указатель на текущий элемент
+         */
+        pointer operator->() const noexcept {
+            return &table_->slot(index_);
+        }
+
+        /**
+         * @brief Префиксный оператор инкремента
+         * @return DenseTableIterator& Ссылка на текущий итератор после инкремента
+         */
+        DenseTableIterator& operator++() noexcept {
+            ++index_;
+            skip_empty_forward();
+            return *this;
+        }
+
+        /**
+         * @brief Постфиксный оператор инкремента
+         * @return DenseTableIterator Итератор до инкремента
+         */
+        DenseTableIterator operator++(int) noexcept {
+            DenseTableIterator res = *this;
+            ++(*this);
+            return res;
+        }
+
+        /**
+         * @brief Префиксный оператор декремента
+         * @return DenseTableIterator& Ссылка на текущий итератор после декремента
+         */
+        DenseTableIterator& operator--() noexcept {
+            --index_;
+            skip_empty_backward();
+            return *this;
+        }
+
+        /**
+         * @brief Постфиксный оператор декремента
+         * @return DenseTableIterator Итератор до декремента
+         */
+        DenseTableIterator operator--(int) noexcept {
+            DenseTableIterator res = *this;
+            --(*this);
+            return res;
+        }
+
+        /**
+         * @brief Оператор сравнения на равенство
+         * @tparam OtherConst Флаг константности другого итератора
+         * @param other Другой итератор
+         * @return bool true если итераторы равны, false в противном случае
+         */
+        template<bool OtherConst>
+        bool operator==(const DenseTableIterator<Key, T, OtherConst>& other) const noexcept {
+            return table_ == other.table_ && index_ == other.index_;
+        }
+
+        /**
+         * @brief Оператор сравнения "меньше"
+         * @tparam OtherConst Флаг константности другого итератора
+         * @param other Другой итератор
+         * @return bool true если текущий итератор меньше другого, false в противном случае
+         */
+        template<bool OtherConst>
+        bool operator<(const DenseTableIterator<Key, T, OtherConst>& other) const noexcept {
+            return index_ < other.index_;
+        }
+
+        /**
+         * @brief Оператор сравнения "больше"
+         * @tparam OtherConst Флаг константности другого итератора
+         * @param other Другой итератор
+         * @return bool true если текущий итератор больше другого, false в противном случае
+         */
+        template<bool OtherConst>
+        bool operator>(const DenseTableIterator<Key, T, OtherConst>& other) const noexcept {
+            return index_ > other.index_;
+        }
+
+        /**
+         * @brief Оператор сравнения "меньше или равно"
+         * @tparam OtherConst Флаг константности другого итератора
+         * @param other Другой итератор
+         * @return bool true если текущий итератор меньше или равен другому, false в противном случае
+         */
+        template<bool OtherConst>
+        bool operator<=(const DenseTableIterator<Key, T, OtherConst>& other) const noexcept {
+            return index_ <= other.index_;
+        }
+
+        /**
+         * @brief Оператор сравнения "больше или равно"
+         * @tparam OtherConst Флаг константности другого итератора
+         * @param other Другой итератор
+         * @return bool true если текущий итератор больше или равен другому, false в противном случае
+         */
+        template<bool OtherConst>
+        bool operator>=(const DenseTableIterator<Key, T, OtherConst>& other) const noexcept {
+            return index_ >= other.index_;
+        }
+};
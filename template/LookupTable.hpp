@@ -7,6 +7,8 @@
 
 #include <vector>
 #include "TableIterator.hpp"
+#include "DenseLookupTable.hpp"
+#include "TableMemoryUsage.hpp"
 #include <concepts>
 #include <stdexcept>
 #include <limits>
@@ -43,10 +45,12 @@ class LookupTable {
 
         /**
          * @brief Находит индекс элемента по ключу
+         * @tparam K Тип ключа для поиска (Key или тип, сравнимый с ним, например std::string_view для std::string)
          * @param key Ключ для поиска
          * @return size_t Индекс элемента или n если не найден
          */
-        size_t find_index(const Key& key) const {
+        template <typename K>
+        size_t find_index(const K& key) const {
             for (size_t i = 0; i < n; ++i) {
                 switch (array_[i].index()) {
                     case 3: {
@@ -276,6 +280,37 @@ class LookupTable {
             n = 0;
         }
 
+        /**
+         * @brief Резервирует память под заданное количество элементов
+         * @param capacity Требуемая вместимость
+         */
+        void reserve(size_type capacity) {
+            array_.reserve(capacity);
+        }
+
+        /**
+         * @brief Получает сведения о памяти, занятой хранилищем ячеек
+         * @return TableMemoryUsage Размер ячейки, количество элементов, удаленных и пустых ячеек, вместимость
+         */
+        TableMemoryUsage memory_usage() const noexcept {
+            return {sizeof(TableNode<Key, T>), sizeof(value_type), size_, n - size_, array_.size() - n, array_.capacity()};
+        }
+
+        /**
+         * @brief Освобождает неиспользуемую память
+         * @details Переносит элементы в новое хранилище точного размера с сохранением порядка,
+         * удаленные и пустые ячейки отбрасываются. Итераторы и ссылки на элементы становятся недействительными.
+         */
+        void shrink_to_fit() {
+            std::vector<TableNode<Key, T>> compact;
+            compact.reserve(size_);
+            for (auto& node : array_) {
+                if (node.index() >= 3) compact.push_back(std::move(node));
+            }
+            array_ = std::move(compact);
+            n = size_;
+        }
+
         /**
          * @brief Обменивает содержимое с другой таблицей
          * @param other Другая таблица
@@ -563,6 +598,18 @@ class LookupTable {
             return index != n ? const_iterator(&array_[index], index, array_.size() - index) : end();
         }
 
+        /**
+         * @brief Находит элемент по ключу другого типа без построения временного Key
+         * @tparam K Тип ключа, сравнимый с Key
+         * @param key Ключ для поиска
+         * @return const_iterator Константный итератор на найденный элемент или end()
+         */
+        template <typename K> requires (!std::same_as<K, Key> && std::equality_comparable_with<Key, K>)
+        const_iterator find(const K& key) const {
+            size_t index = find_index(key);
+            return index != n ? const_iterator(&array_[index], index, array_.size() - index) : end();
+        }
+
         /**
          * @brief Проверяет наличие элемента с заданным ключом
          * @param key Ключ для проверки
@@ -751,7 +798,7 @@ class LookupTable {
 
 
 
-template <typename Key, typename T>
+template <typename Key, typename T> requires (!DenseEnumKey<Key>)
 class LookupTable<Key, std::unique_ptr<T>> {
     private:
         std::vector<TableNode<Key, std::unique_ptr<T>>> array_;
@@ -768,7 +815,8 @@ class LookupTable<Key, std::unique_ptr<T>> {
             }
         }
 
-        size_t find_index(const Key& key) const {
+        template <typename K>
+        size_t find_index(const K& key) const {
             for (size_t i = 0; i < n; ++i) {
                 switch (array_[i].index()) {
                     case 3: {
@@ -903,6 +951,24 @@ class LookupTable<Key, std::unique_ptr<T>> {
             n = 0;
         }
 
+        void reserve(size_type capacity) {
+            array_.reserve(capacity);
+        }
+
+        TableMemoryUsage memory_usage() const noexcept {
+            return {sizeof(TableNode<Key, std::unique_ptr<T>>), sizeof(value_type), size_, n - size_, array_.size() - n, array_.capacity()};
+        }
+
+        void shrink_to_fit() {
+            std::vector<TableNode<Key, std::unique_ptr<T>>> compact;
+            compact.reserve(size_);
+            for (auto& node : array_) {
+                if (node.index() >= 3) compact.push_back(std::move(node));
+            }
+            array_ = std::move(compact);
+            n = size_;
+        }
+
         void swap(LookupTable& other) noexcept {
             array_.swap(other.array_);
             std::swap(size_, other.size_);
@@ -1095,6 +1161,12 @@ class LookupTable<Key, std::unique_ptr<T>> {
             return index != n ? const_iterator(&array_[index], index, array_.size() - index) : end();
         }
 
+        template <typename K> requires (!std::same_as<K, Key> && std::equality_comparable_with<Key, K>)
+        const_iterator find(const K& key) const {
+            size_t index = find_index(key);
+            return index != n ? const_iterator(&array_[index], index, array_.size() - index) : end();
+        }
+
         bool contains(const Key& key) const {
             return find_index(key) != n;
         }
@@ -0,0 +1,257 @@
+/**
+ * @file ObjectPool.hpp
+ * @brief Заголовочный файл, содержащий определение классов ObjectPool и PoolAllocated
+ */
+
+#pragma once
+
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <cstddef>
+#include <algorithm>
+
+/**
+ * @class ObjectPool
+ * @brief Пул памяти фиксированного размера для объектов типа T
+ * @details Память выделяется блоками по BlockSize ячеек, поэтому объекты одного типа лежат в памяти подряд.
+ * Освобожденные ячейки попадают в локальный список свободных ячеек потока и переиспользуются без блокировок,
+ * с общим списком под мьютексом поток обменивается пачками по cache_batch ячеек.
+ * @tparam T Тип размещаемых объектов
+ * @tparam BlockSize Количество ячеек в одном блоке
+ */
+template <typename T, size_t BlockSize = 256>
+class ObjectPool {
+    private:
+        /**
+         * @brief Ячейка пула: либо хранилище объекта, либо звено списка свободных ячеек
+         */
+        union Slot {
+            Slot* next; ///< Следующая свободная ячейка
+            alignas(T) std::byte storage[sizeof(T)]; ///< Хранилище объекта
+        };
+
+        /**
+         * @struct LocalCache
+         * @brief Список свободных ячеек одного потока
+         * @details При завершении потока ячейки возвращаются в общий список.
+         */
+        struct LocalCache {
+            Slot* head = nullptr; ///< Голова списка
+            size_t count = 0; ///< Количество ячеек в списке
+            uint64_t generation = 0; ///< Поколение пула, из которого получены ячейки
+
+            /**
+             * @brief Деструктор, возвращающий ячейки в общий список
+             */
+            ~LocalCache() {
+                ObjectPool::instance().give_back(*this, count);
+            }
+        };
+
+        static constexpr size_t cache_batch = BlockSize / 4 > 0 ? BlockSize / 4 : 1; ///< Количество ячеек, переносимых между списками за раз
+        static constexpr size_t cache_limit = cache_batch * 2; ///< Размер локального списка, после которого ячейки возвращаются в общий
+
+        std::vector<Slot*> blocks_; ///< Выделенные блоки ячеек
+        Slot* free_list_ = nullptr; ///< Голова общего списка свободных ячеек
+        size_t capacity_ = 0; ///< Общее количество ячеек во всех блоках
+        std::atomic<size_t> in_use_ = 0; ///< Количество занятых ячеек
+        std::atomic<uint64_t> generation_ = 0; ///< Поколение пула (увеличивается при освобождении блоков)
+        mutable std::mutex mutex_; ///< Мьютекс общего списка и блоков
+
+        /**
+         * @brief Выделяет новый блок и добавляет его ячейки в общий список свободных
+         * @param slot_count Количество ячеек в блоке
+         */
+        void grow(size_t slot_count) {
+            Slot* block = static_cast<Slot*>(::operator new(slot_count * sizeof(Slot), std::align_val_t(alignof(Slot))));
+            blocks_.push_back(block);
+            for (size_t i = slot_count; i > 0; --i) {
+                block[i - 1].next = free_list_;
+                free_list_ = &block[i - 1];
+            }
+            capacity_ += slot_count;
+        }
+
+        /**
+         * @brief Освобождает все блоки
+         */
+        void free_blocks() noexcept {
+            for (Slot* block : blocks_) ::operator delete(block, std::align_val_t(alignof(Slot)));
+            blocks_.clear();
+            free_list_ = nullptr;
+            capacity_ = 0;
+        }
+
+        /**
+         * @brief Получает локальный список текущего потока, сбрасывая его, если ячейки принадлежат освобожденным блокам
+         * @return LocalCache& Ссылка на локальный список
+         */
+        LocalCache& local_cache() noexcept {
+            thread_local LocalCache cache;
+            uint64_t generation = generation_.load(std::memory_order_acquire);
+            if (cache.generation != generation) {
+                cache.head = nullptr;
+                cache.count = 0;
+                cache.generation = generation;
+            }
+            return cache;
+        }
+
+        /**
+         * @brief Переносит пачку ячеек из общего списка в локальный
+         * @param cache Локальный список
+         */
+        void refill(LocalCache& cache) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!free_list_) grow(BlockSize);
+            for (size_t i = 0; i < cache_batch && free_list_; ++i) {
+                Slot* slot = free_list_;
+                free_list_ = slot->next;
+                slot->next = cache.head;
+                cache.head = slot;
+                ++cache.count;
+            }
+        }
+
+        /**
+         * @brief Возвращает ячейки из локального списка в общий
+         * @param cache Локальный список
+         * @param count Количество возвращаемых ячеек
+         */
+        void give_back(LocalCache& cache, size_t count) noexcept {
+            if (cache.generation != generation_.load(std::memory_order_acquire)) return;
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (size_t i = 0; i < count && cache.head; ++i) {
+                Slot* slot = cache.head;
+                cache.head = slot->next;
+                --cache.count;
+                slot->next = free_list_;
+                free_list_ = slot;
+            }
+        }
+
+        ObjectPool() = default;
+    public:
+        ObjectPool(const ObjectPool&) = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        /**
+         * @brief Деструктор (блоки освобождаются, только если в пуле не осталось живых объектов)
+         */
+        ~ObjectPool() {
+            if (in_use_.load(std::memory_order_relaxed) == 0) free_blocks();
+        }
+
+        /**
+         * @brief Получает единственный пул для типа T
+         * @return ObjectPool& Ссылка на пул
+         */
+        static ObjectPool& instance() {
+            static ObjectPool pool;
+            return pool;
+        }
+
+        /**
+         * @brief Выделяет память под один объект
+         * @return void* Указатель на неинициализированную память
+         */
+        void* allocate() {
+            LocalCache& cache = local_cache();
+            if (!cache.head) refill(cache);
+            Slot* slot = cache.head;
+            cache.head = slot->next;
+            --cache.count;
+            in_use_.fetch_add(1, std::memory_order_relaxed);
+            return slot->storage;
+        }
+
+        /**
+         * @brief Возвращает память объекта в пул
+         * @param ptr Указатель, ранее полученный из allocate()
+         */
+        void deallocate(void* ptr) noexcept {
+            if (!ptr) return;
+            LocalCache& cache = local_cache();
+            Slot* slot = reinterpret_cast<Slot*>(ptr);
+            slot->next = cache.head;
+            cache.head = slot;
+            ++cache.count;
+            in_use_.fetch_sub(1, std::memory_order_relaxed);
+            if (cache.count > cache_limit) give_back(cache, cache.count - cache_batch);
+        }
+
+        /**
+         * @brief Резервирует место под заданное количество объектов одним непрерывным блоком
+         * @param count Требуемое количество свободных ячеек
+         */
+        void reserve(size_t count) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            size_t available = capacity_ - in_use_.load(std::memory_order_relaxed);
+            if (count > available) grow(std::max(count - available, BlockSize));
+        }
+
+        /**
+         * @brief Освобождает все блоки, если в пуле нет живых объектов
+         * @details Локальные списки потоков сбрасываются при следующем обращении. Не вызывается одновременно с выделением памяти в других потоках.
+         * @return bool true если память освобождена, false в противном случае
+         */
+        bool release() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (in_use_.load(std::memory_order_relaxed) != 0) return false;
+            free_blocks();
+            generation_.fetch_add(1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Получает общее количество ячеек
+         * @return size_t Количество ячеек
+         */
+        size_t capacity() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return capacity_;
+        }
+
+        /**
+         * @brief Получает количество занятых ячеек
+         * @return size_t Количество живых объектов
+         */
+        size_t in_use() const {
+            return in_use_.load(std::memory_order_relaxed);
+        }
+};
+
+/**
+ * @class PoolAllocated
+ * @brief Базовый класс, размещающий объекты наследника в ObjectPool
+ * @details Перегружает operator new/delete, поэтому std::make_unique и std::unique_ptr с deleter по умолчанию
+ * работают с пулом без изменений. Объекты других размеров (наследники Derived) размещаются в общей куче
+ * с выравниванием Derived.
+ * @tparam Derived Тип наследника
+ */
+template <typename Derived>
+class PoolAllocated {
+    public:
+        /**
+         * @brief Выделяет память под объект
+         * @param size Размер объекта
+         * @return void* Указатель на память
+         */
+        static void* operator new(size_t size) {
+            if (size != sizeof(Derived)) return ::operator new(size, std::align_val_t(alignof(Derived)));
+            return ObjectPool<Derived>::instance().allocate();
+        }
+
+        /**
+         * @brief Освобождает память объекта
+         * @param ptr Указатель на память
+         * @param size Размер объекта
+         */
+        static void operator delete(void* ptr, size_t size) noexcept {
+            if (size != sizeof(Derived)) ::operator delete(ptr, size, std::align_val_t(alignof(Derived)));
+            else ObjectPool<Derived>::instance().deallocate(ptr);
+        }
+};
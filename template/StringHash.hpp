@@ -0,0 +1,28 @@
+/**
+ * @file StringHash.hpp
+ * @brief Заголовочный файл, содержащий определение прозрачной хеш-функции для строк
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <functional>
+#include <cstddef>
+
+/**
+ * @struct StringHash
+ * @brief Хеш-функция для std::unordered_map со строковыми ключами, допускающая поиск по std::string_view без создания std::string
+ */
+struct StringHash {
+    using is_transparent = void; ///< Признак прозрачного сравнения
+
+    /**
+     * @brief Вычисляет хеш строки
+     * @param str Строка
+     * @return size_t Хеш строки
+     */
+    size_t operator()(std::string_view str) const noexcept {
+        return std::hash<std::string_view>{}(str);
+    }
+};
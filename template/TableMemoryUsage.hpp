@@ -0,0 +1,46 @@
+/**
+ * @file TableMemoryUsage.hpp
+ * @brief Заголовочный файл, содержащий определение структуры TableMemoryUsage
+ */
+
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @struct TableMemoryUsage
+ * @brief Сведения о памяти, занятой хранилищем ячеек LookupTable
+ * @details Память объектов, на которые указывают значения (например, unique_ptr), не учитывается
+ */
+struct TableMemoryUsage {
+    size_t node_bytes = 0; ///< Размер одной ячейки в байтах
+    size_t payload_bytes = 0; ///< Размер пары ключ-значение в байтах
+    size_t size = 0; ///< Количество элементов
+    size_t tombstones = 0; ///< Количество удаленных ячеек, которые еще просматриваются при поиске
+    size_t free_slots = 0; ///< Количество пустых ячеек, готовых к повторному использованию
+    size_t capacity = 0; ///< Вместимость хранилища в ячейках
+
+    /**
+     * @brief Получает объем памяти, занятой ячейками с элементами
+     * @return size_t Объем памяти в байтах
+     */
+    size_t used_bytes() const {
+        return size * node_bytes;
+    }
+
+    /**
+     * @brief Получает объем памяти, выделенной под хранилище
+     * @return size_t Объем памяти в байтах
+     */
+    size_t reserved_bytes() const {
+        return capacity * node_bytes;
+    }
+
+    /**
+     * @brief Получает объем выделенной памяти сверх полезных данных (пустые и удаленные ячейки, служебные поля ячеек)
+     * @return size_t Объем памяти в байтах
+     */
+    size_t overhead_bytes() const {
+        return reserved_bytes() - size * payload_bytes;
+    }
+};
@@ -4,6 +4,9 @@
 #include <vector>
 #include <string>
 #include <cmath>
+#include <thread>
+#include <atomic>
+#include <sstream>
 #include "template/MyClass.hpp"
 
 #include "entity/ship/Concrete/GuardShip.hpp"
@@ -29,6 +32,7 @@
 
 #include "mapper/ship/Managers/ShipMapperManager.hpp"
 #include "mapper/ship/Managers/ShipDTOMapperManager.hpp"
+#include "mapper/ship/ToDTO/FleetSnapshotMapper.hpp"
 
 #include "repository/PirateRepository.hpp"
 #include "repository/ShipRepository.hpp"
@@ -41,7 +45,15 @@
 #include "service/purchase/PurchaseService.hpp"
 #include "service/state/YamlStateService.hpp"
 
+#include "visitor/place/PlaceForDPSVisitor.hpp"
+#include "visitor/place/PlaceForDamageVisitor.hpp"
+#include "visitor/weapon/ShootingVisitor.hpp"
+#include "service/combat/HitResolver.hpp"
+#include "auxiliary/Tracer.hpp"
+#include "auxiliary/LatencyHistogram.hpp"
+
 #include "loader/Loader.hpp"
+#include "presenter/InstrumentedPresenter.hpp"
 
 const double EPS = 1e-9;
 
@@ -376,6 +388,46 @@ TEST_CASE("Class LookupTable") {
             REQUIRE(table_2.contains(2));
         }
     }
+    SECTION("Memory usage") {
+        LookupTable<int, std::string> table;
+        for (int i = 0; i < 100; ++i) table.insert(i, std::to_string(i));
+        for (int i = 0; i < 100; i += 2) table.erase(i);
+        TableMemoryUsage usage = table.memory_usage();
+        REQUIRE(usage.node_bytes == sizeof(TableNode<int, std::string>));
+        REQUIRE(usage.payload_bytes == sizeof(std::pair<const int, std::string>));
+        REQUIRE(usage.size == 50);
+        REQUIRE(usage.tombstones == 50);
+        REQUIRE(usage.capacity >= 100);
+        REQUIRE(usage.used_bytes() == 50 * usage.node_bytes);
+        REQUIRE(usage.overhead_bytes() == usage.reserved_bytes() - 50 * usage.payload_bytes);
+
+        table.shrink_to_fit();
+        usage = table.memory_usage();
+        REQUIRE(usage.size == 50);
+        REQUIRE(usage.tombstones == 0);
+        REQUIRE(usage.free_slots == 0);
+        REQUIRE(usage.capacity == 50);
+        int expected = 1;
+        for (const auto& [key, value] : table) {
+            REQUIRE(key == expected);
+            REQUIRE(value == std::to_string(key));
+            expected += 2;
+        }
+
+        table.erase(1);
+        table.insert(100, "100");
+        table.insert(101, "101");
+        REQUIRE(table.size() == 51);
+        REQUIRE(table.at(100) == "100");
+        REQUIRE(table.at(101) == "101");
+        REQUIRE(!table.contains(1));
+
+        LookupTable<int, std::string> empty_table;
+        empty_table.shrink_to_fit();
+        REQUIRE(empty_table.memory_usage().capacity == 0);
+        empty_table.insert(1, "apple");
+        REQUIRE(empty_table.at(1) == "apple");
+    }
 }
 
 TEST_CASE("Class TableIterator") {
@@ -1352,6 +1404,87 @@ TEST_CASE("Class LookupTable with unique_ptr") {
             REQUIRE(table_1.empty());
         }
     }
+    SECTION("Memory usage") {
+        LookupTable<std::string, std::unique_ptr<int>> table;
+        for (int i = 0; i < 10; ++i) table.insert(std::to_string(i), std::make_unique<int>(i));
+        int* kept = table.at("9").get();
+        for (int i = 0; i < 8; ++i) table.erase(std::to_string(i));
+        REQUIRE(table.memory_usage().tombstones == 8);
+
+        table.shrink_to_fit();
+        TableMemoryUsage usage = table.memory_usage();
+        REQUIRE(usage.size == 2);
+        REQUIRE(usage.tombstones == 0);
+        REQUIRE(usage.capacity == 2);
+        REQUIRE(table.at("9").get() == kept);
+        REQUIRE(*table.at("8") == 8);
+        table.insert("10", std::make_unique<int>(10));
+        REQUIRE(*table.at("10") == 10);
+    }
+}
+
+TEST_CASE("Class LookupTable with enum key") {
+    SECTION("Basic") {
+        static_assert(std::is_same_v<LookupTable<PlaceForWeapon, int>::iterator, DenseTableIterator<PlaceForWeapon, int, false>>);
+        LookupTable<PlaceForWeapon, std::string> table;
+        REQUIRE(table.empty());
+        REQUIRE(table.max_size() == 4);
+        REQUIRE(table.insert(PlaceForWeapon::port, "port").second);
+        REQUIRE(!table.insert(PlaceForWeapon::port, "other").second);
+        table[PlaceForWeapon::stern] = "stern";
+        REQUIRE(table.size() == 2);
+        REQUIRE(table.contains(PlaceForWeapon::stern));
+        REQUIRE(!table.contains(PlaceForWeapon::bow));
+        REQUIRE(table.at(PlaceForWeapon::port) == "port");
+        REQUIRE_THROWS_AS(table.at(PlaceForWeapon::bow), std::out_of_range);
+        REQUIRE(table.find(PlaceForWeapon::bow) == table.end());
+
+        std::vector<PlaceForWeapon> keys;
+        for (const auto& [key, value] : table) keys.push_back(key);
+        REQUIRE(keys == std::vector<PlaceForWeapon>{PlaceForWeapon::stern, PlaceForWeapon::port});
+        auto last = table.end();
+        --last;
+        REQUIRE(last->first == PlaceForWeapon::port);
+
+        LookupTable<PlaceForWeapon, std::string> copy(table);
+        REQUIRE(copy == table);
+        REQUIRE(table.erase(PlaceForWeapon::stern) == 1);
+        REQUIRE(table.erase(PlaceForWeapon::stern) == 0);
+        REQUIRE(!(copy == table));
+        auto it = copy.erase(copy.find(PlaceForWeapon::stern));
+        REQUIRE(it->first == PlaceForWeapon::port);
+        REQUIRE(copy == table);
+        copy.clear();
+        REQUIRE(copy.begin() == copy.end());
+    }
+
+    SECTION("unique_ptr") {
+        LookupTable<PlaceForWeapon, std::unique_ptr<int>> table;
+        table[PlaceForWeapon::bow] = std::make_unique<int>(5);
+        table.insert(PlaceForWeapon::starboard, std::make_unique<int>(7));
+        REQUIRE(*table.at(PlaceForWeapon::bow) == 5);
+
+        LookupTable<PlaceForWeapon, std::unique_ptr<int>> moved(std::move(table));
+        REQUIRE(table.empty());
+        REQUIRE(moved.size() == 2);
+        REQUIRE(*moved.find(PlaceForWeapon::starboard)->second == 7);
+
+        LookupTable<PlaceForWeapon, std::unique_ptr<int>> other;
+        other[PlaceForWeapon::bow] = std::make_unique<int>(5);
+        other[PlaceForWeapon::starboard] = std::make_unique<int>(7);
+        REQUIRE(other == moved);
+    }
+    SECTION("Memory usage") {
+        LookupTable<PlaceForWeapon, int> table;
+        table[PlaceForWeapon::bow] = 1;
+        table.shrink_to_fit();
+        TableMemoryUsage usage = table.memory_usage();
+        REQUIRE(usage.size == 1);
+        REQUIRE(usage.capacity == dense_enum_size<PlaceForWeapon>::value);
+        REQUIRE(usage.free_slots == usage.capacity - 1);
+        REQUIRE(usage.tombstones == 0);
+        REQUIRE(table.at(PlaceForWeapon::bow) == 1);
+    }
 }
 
 TEST_CASE("Class GuardShip") {
@@ -1534,6 +1667,42 @@ TEST_CASE("Class DefaultGuard") {
         guard.set_weapon_in_place(PlaceForWeapon::stern, std::move(rocket));
         REQUIRE((guard.get_max_range() - 5.0) < EPS);
     }
+    SECTION("Weapon profile") {
+        GuardShip ship;
+        REQUIRE(!ship.best_place_by_dps(1.0).has_value());
+        ship.set_weapon_in_place(PlaceForWeapon::bow, std::make_unique<Gun>());
+        ship.set_weapon_in_place(PlaceForWeapon::stern, std::make_unique<Rocket>());
+        REQUIRE(ship.best_place_by_dps(2.0) == PlaceForWeapon::bow);
+        REQUIRE(ship.best_place_by_damage(2.0) == PlaceForWeapon::stern);
+        REQUIRE(ship.best_place_by_dps(4.0) == PlaceForWeapon::stern);
+        REQUIRE(!ship.best_place_by_dps(6.0).has_value());
+
+        PlaceForDPSVisitor dps_visitor(6.0);
+        ship.accept(&dps_visitor);
+        REQUIRE(dps_visitor.has_place());
+        REQUIRE(dps_visitor.get_place() == PlaceForWeapon::bow);
+        PlaceForDamageVisitor damage_visitor(2.0);
+        ship.accept(&damage_visitor);
+        REQUIRE(damage_visitor.get_place() == PlaceForWeapon::stern);
+
+        ship.remove_weapon_from_place(PlaceForWeapon::stern);
+        REQUIRE(ship.best_place_by_damage(2.0) == PlaceForWeapon::bow);
+        ship.set_weapon_in_place(PlaceForWeapon::port, std::make_unique<Rocket>());
+        REQUIRE(ship.best_place_by_damage(2.0) == PlaceForWeapon::port);
+
+        GuardShip target;
+        target.set_position(Vector(1.0, 0.0));
+        DamageService damage_service;
+        ship.modify_weapon_in_place(PlaceForWeapon::bow, [](IWeapon& weapon) { weapon.set_damage(1000.0); });
+        REQUIRE(ship.best_place_by_damage(2.0) == PlaceForWeapon::bow);
+        REQUIRE(!ship.modify_weapon_in_place(PlaceForWeapon::starboard, [](IWeapon& weapon) { weapon.set_damage(0.0); }));
+        ship.modify_weapon_in_place(PlaceForWeapon::bow, [](IWeapon& weapon) { weapon.set_current_ammo(1); });
+        ShootingVisitor shooting_visitor(PlaceForWeapon::bow, &target, damage_service);
+        ship.accept(&shooting_visitor);
+        REQUIRE(shooting_visitor.shot_fired());
+        REQUIRE(ship.get_weapon_in_place(PlaceForWeapon::bow)->get_current_ammo() == 0);
+        REQUIRE(ship.best_place_by_dps(1.0) == PlaceForWeapon::port);
+    }
 }
 
 TEST_CASE("Class DefaultShip") {
@@ -1589,6 +1758,26 @@ TEST_CASE("Class DefaultShip") {
         REQUIRE(!ship.is_alive());
 
     }
+    SECTION("Ship variant") {
+        TransportShip transport;
+        GuardShip guard;
+        WarShip war;
+        std::vector<IShip*> ships = {&transport, &guard, &war};
+        std::vector<ShipVariant> variants;
+        for (auto ship : ships) variants.push_back(ship->as_variant());
+
+        REQUIRE(std::get<TransportShip*>(variants[0]) == &transport);
+        REQUIRE(std::get<GuardShip*>(variants[1]) == &guard);
+        REQUIRE(std::get<WarShip*>(variants[2]) == &war);
+
+        auto max_cargo = [](auto* ship) {
+            if constexpr (std::is_base_of_v<DefaultCargo, std::remove_pointer_t<decltype(ship)>>) return ship->get_max_cargo();
+            else return 0.0;
+        };
+        REQUIRE(std::abs(std::visit(max_cargo, variants[0]) - 1000.0) < EPS);
+        REQUIRE(std::abs(std::visit(max_cargo, variants[1])) < EPS);
+        REQUIRE(std::abs(std::visit(max_cargo, variants[2]) - 500.0) < EPS);
+    }
 }
 
 TEST_CASE("Class ShipFactoryManager") {
@@ -1694,6 +1883,74 @@ TEST_CASE("Class ShipFactoryManager") {
         REQUIRE(std::abs(transport_clone->get_cost() - 5000.0) < EPS);
         REQUIRE(transport_clone->get_ID() == "");
     }
+
+    SECTION("Pool") {
+        GuardShipFactory factory;
+        ObjectPool<GuardShip>& pool = ObjectPool<GuardShip>::instance();
+        size_t in_use = pool.in_use();
+
+        factory.reserve(1000);
+        REQUIRE(pool.capacity() - pool.in_use() >= 1000);
+
+        std::unique_ptr<IShip> first = factory.create_ship();
+        REQUIRE(pool.in_use() == in_use + 1);
+        IShip* address = first.get();
+        first.reset();
+        REQUIRE(pool.in_use() == in_use);
+
+        std::unique_ptr<IShip> second = factory.create_ship();
+        REQUIRE(second.get() == address);
+        std::unique_ptr<IShip> second_clone = second->clone();
+        REQUIRE(pool.in_use() == in_use + 2);
+    }
+
+    SECTION("Pool fallback keeps alignment") {
+        struct alignas(64) Pooled : PoolAllocated<Pooled> {
+            double value = 0.0;
+            virtual ~Pooled() = default;
+        };
+        struct Larger : Pooled {
+            double extra[16] = {};
+        };
+
+        size_t in_use = ObjectPool<Pooled>::instance().in_use();
+        std::unique_ptr<Pooled> larger = std::make_unique<Larger>();
+        REQUIRE(reinterpret_cast<uintptr_t>(larger.get()) % alignof(Pooled) == 0);
+        REQUIRE(ObjectPool<Pooled>::instance().in_use() == in_use);
+        larger.reset();
+
+        std::unique_ptr<Pooled> pooled = std::make_unique<Pooled>();
+        REQUIRE(reinterpret_cast<uintptr_t>(pooled.get()) % alignof(Pooled) == 0);
+        REQUIRE(ObjectPool<Pooled>::instance().in_use() == in_use + 1);
+    }
+
+    SECTION("Pool release and thread caches") {
+        struct Released : PoolAllocated<Released> {
+            double value = 0.0;
+        };
+        ObjectPool<Released>& pool = ObjectPool<Released>::instance();
+
+        std::vector<std::unique_ptr<Released>> objects;
+        for (size_t i = 0; i < 300; ++i) objects.push_back(std::make_unique<Released>());
+        REQUIRE(pool.in_use() == 300);
+        REQUIRE_FALSE(pool.release());
+
+        std::thread worker([&objects]() {
+            for (size_t i = 0; i < 150; ++i) objects[i].reset();
+            for (size_t i = 0; i < 50; ++i) objects[i] = std::make_unique<Released>();
+        });
+        worker.join();
+        REQUIRE(pool.in_use() == 200);
+
+        objects.clear();
+        REQUIRE(pool.in_use() == 0);
+        REQUIRE(pool.release());
+        REQUIRE(pool.capacity() == 0);
+
+        std::unique_ptr<Released> fresh = std::make_unique<Released>();
+        REQUIRE(pool.in_use() == 1);
+        REQUIRE(pool.capacity() > 0);
+    }
 }
 
 TEST_CASE("Class Gun") {
@@ -1829,6 +2086,63 @@ TEST_CASE("Class WeaponFactoryManager") {
     }
 }
 
+TEST_CASE("Tracer") {
+    SECTION("Buffer") {
+        TraceBuffer buffer(7);
+        for (size_t i = 0; i < 2500; ++i) buffer.push(TraceEvent{"test", "event", static_cast<int64_t>(i), 1, 0.0, 'X'});
+        size_t count = 0;
+        int64_t last = -1;
+        bool ordered = true;
+        buffer.for_each([&](const TraceEvent& event) {
+            ordered = ordered && event.timestamp_ns == last + 1;
+            last = event.timestamp_ns;
+            ++count;
+        });
+        REQUIRE(count == 2500);
+        REQUIRE(ordered);
+        REQUIRE(buffer.get_thread_id() == 7);
+        REQUIRE(buffer.get_dropped() == 0);
+    }
+    SECTION("Chrome trace") {
+        Tracer& tracer = Tracer::instance();
+        size_t before = tracer.event_count();
+        {
+            TraceSpan span("test", "tracer_span");
+            std::vector<std::jthread> threads;
+            for (size_t t = 0; t < 2; ++t) {
+                threads.emplace_back([]() { TraceSpan worker_span("test", "tracer_worker_span"); });
+            }
+        }
+        tracer.counter("test", "tracer_counter", 42.0);
+        REQUIRE(tracer.event_count() == before + 4);
+
+        std::ostringstream out;
+        tracer.write_chrome_trace(out);
+        std::string json = out.str();
+        REQUIRE(json.starts_with("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+        REQUIRE(json.ends_with("]}"));
+        REQUIRE(json.find("\"name\":\"tracer_span\",\"cat\":\"test\",\"ph\":\"X\"") != std::string::npos);
+        REQUIRE(json.find("\"name\":\"tracer_worker_span\"") != std::string::npos);
+        REQUIRE(json.find("\"args\":{\"value\":42}") != std::string::npos);
+    }
+    SECTION("Buffer reuse") {
+        Tracer& tracer = Tracer::instance();
+        {
+            std::jthread warmup([]() { TraceSpan span("test", "tracer_warmup"); });
+        }
+        size_t buffers = tracer.buffer_count();
+        size_t events = tracer.event_count();
+        for (size_t round = 0; round < 50; ++round) {
+            std::vector<std::jthread> threads;
+            for (size_t t = 0; t < 4; ++t) {
+                threads.emplace_back([]() { TraceSpan span("test", "tracer_short_lived"); });
+            }
+        }
+        REQUIRE(tracer.event_count() == events + 200);
+        REQUIRE(tracer.buffer_count() <= buffers + 3);
+    }
+}
+
 TEST_CASE("Mission") {
     SECTION("Constructor") {
         PirateBase pb;
@@ -1889,6 +2203,40 @@ TEST_CASE("Mission") {
         const PirateBase pb2 = mission2.get_pirate_base(1);
         REQUIRE(pb2 == p_bases[1]);
     }
+    SECTION("Concurrent budget and cargo") {
+        Mission mission("mission_1", Military("Барсуков", "Майор"), 1000.0, 1000.0, 50.0, 5, 5, Vector(), Vector(25.0, 25.0), 3.0, {});
+        std::atomic<size_t> purchases{0};
+        {
+            std::vector<std::jthread> threads;
+            for (size_t t = 0; t < 8; ++t) {
+                threads.emplace_back([&mission, &purchases]() {
+                    for (size_t i = 0; i < 200; ++i) {
+                        if (mission.remove_budget(1.0)) ++purchases;
+                        mission.add_cargo(1.0);
+                        mission.remove_cargo(0.5);
+                    }
+                });
+            }
+        }
+        REQUIRE(purchases == 1000);
+        REQUIRE(std::abs(mission.get_current_budget()) < EPS);
+        REQUIRE(!mission.can_spend(1.0));
+        REQUIRE(std::abs(mission.get_current_cargo() - 800.0) < EPS);
+
+        Mission copy(mission);
+        REQUIRE(std::abs(copy.get_current_cargo() - 800.0) < EPS);
+    }
+    SECTION("World version") {
+        Mission mission("mission_1", Military("Барсуков", "Майор"), 1000.0, 1000.0, 50.0, 5, 5, Vector(), Vector(25.0, 25.0), 3.0, {});
+        size_t version = mission.get_world_version();
+        REQUIRE(!mission.remove_budget(2000.0));
+        REQUIRE(mission.get_world_version() == version);
+        mission.add_budget(10.0);
+        REQUIRE(mission.get_world_version() > version);
+        version = mission.get_world_version();
+        mission.touch();
+        REQUIRE(mission.get_world_version() == version + 1);
+    }
 }
 
 TEST_CASE("Mission mapper") {
@@ -2129,6 +2477,55 @@ TEST_CASE("Ship mapper") {
         REQUIRE(std::abs(transport_ship_dto.max_cargo - 1000) < EPS);
         REQUIRE(std::abs(transport_ship_dto.speed_reduction_factor - 0.1) < EPS);
     }
+
+    SECTION("Fleet snapshot") {
+        std::vector<std::unique_ptr<IShip>> owned;
+        for (size_t i = 0; i < 3; ++i) {
+            auto guard = std::make_unique<GuardShip>("Охранник", Military("Барсуков", "Майор"), 50.0, 100.0, 10000.0, "G" + std::to_string(i), true, Vector(i * 1.0, 2.0));
+            guard->set_weapon_in_place(PlaceForWeapon::bow, std::make_unique<Gun>("Пушка", 20.0, 5.0, 2, 10, 100.0, 0.9));
+            if (i == 1) guard->set_weapon_in_place(PlaceForWeapon::stern, std::make_unique<Gun>("Пушка", 10.0, 5.0, 2, 10, 100.0, 0.9));
+            owned.push_back(std::move(guard));
+        }
+        owned.push_back(std::make_unique<TransportShip>());
+        std::vector<IShip*> ships;
+        for (const auto& ship : owned) ships.push_back(ship.get());
+        ships.insert(ships.begin() + 1, nullptr);
+
+        FleetSnapshotMapper mapper;
+        FleetSnapshot snapshot = mapper.transform(ships);
+        REQUIRE(snapshot.size() == 4);
+        REQUIRE(snapshot.name[0] == snapshot.name[2]);
+        REQUIRE(snapshot.captain_fio[0] == snapshot.captain_fio[1]);
+        REQUIRE(snapshot.str(snapshot.id[1]) == "G1");
+        REQUIRE(snapshot.str(snapshot.type[3]) == "transport");
+        REQUIRE(std::abs(snapshot.position_x[2] - 2.0) < EPS);
+        REQUIRE(snapshot.max_cargo[0] < EPS);
+        REQUIRE(std::abs(snapshot.max_cargo[3] - 1000.0) < EPS);
+        REQUIRE(snapshot.weapon_begin == std::vector<uint32_t>{0, 1, 3, 4, 4});
+        REQUIRE(snapshot.weapons[1].place == PlaceForWeapon::stern);
+        REQUIRE(snapshot.weapons[1].type == snapshot.weapons[0].type);
+
+        ShipDTOMapperManager manager;
+        ShipDTO expected = manager.create_ship_dto(ships[2]);
+        ShipDTO restored = mapper.to_ship_dto(snapshot, 1);
+        REQUIRE(restored.id == expected.id);
+        REQUIRE(restored.type == expected.type);
+        REQUIRE(restored.captain == expected.captain);
+        REQUIRE(restored.position == expected.position);
+        REQUIRE(restored.weapons.size() == expected.weapons.size());
+        REQUIRE(std::abs(restored.weapons.at(PlaceForWeapon::stern).damage - expected.weapons.at(PlaceForWeapon::stern).damage) < EPS);
+
+        std::vector<std::unique_ptr<IShip>> crowd;
+        std::vector<IShip*> crowd_ptrs;
+        for (size_t i = 0; i < 64; ++i) {
+            crowd.push_back(std::make_unique<GuardShip>("Охранник", Military("Барсуков", "Майор"), 50.0, 100.0, 10000.0, "C" + std::to_string(i), true, Vector()));
+            crowd_ptrs.push_back(crowd.back().get());
+        }
+        FleetSnapshot crowd_snapshot = mapper.transform(crowd_ptrs);
+        REQUIRE(crowd_snapshot.strings.size() == 64 + 4);
+        REQUIRE(crowd_snapshot.str(crowd_snapshot.id[63]) == "C63");
+        REQUIRE(crowd_snapshot.name[0] == crowd_snapshot.name[63]);
+    }
 }
 
 TEST_CASE("Repository") {
@@ -2270,6 +2667,88 @@ TEST_CASE("Repository") {
         pirate_repo.clear();
         REQUIRE(pirate_repo.count() == 0);
     }
+    SECTION("Active set") {
+        PirateRepository pirate_repo;
+        for (std::string id : {"active_a", "active_b", "active_c", "active_d"}) {
+            pirate_repo.create(std::make_unique<GuardShip>("Пират", Military(), 50.0, 100.0, 10000.0, id, false));
+        }
+        IShip* a = pirate_repo.get_ship_ptr("active_a");
+        IShip* b = pirate_repo.get_ship_ptr("active_b");
+        IShip* c = pirate_repo.get_ship_ptr("active_c");
+        IShip* d = pirate_repo.get_ship_ptr("active_d");
+        REQUIRE(pirate_repo.count_alive() == 4);
+        REQUIRE(pirate_repo.count_destroyed() == 0);
+
+        b->take_damage(1000.0);
+        d->take_damage(1000.0);
+        REQUIRE(pirate_repo.count_alive() == 2);
+        REQUIRE(pirate_repo.get_alive_ships() == std::vector<IShip*>{a, c});
+        REQUIRE(pirate_repo.get_destroyed_ships() == std::vector<IShip*>{b, d});
+        REQUIRE(pirate_repo.get_all_ship_ptrs().size() == 4);
+        REQUIRE(pirate_repo.get_weakest_ship() == a);
+
+        pirate_repo.remove("active_b");
+        REQUIRE(pirate_repo.get_destroyed_ships() == std::vector<IShip*>{d});
+        pirate_repo.update(std::make_unique<GuardShip>("Пират", Military(), 50.0, 100.0, 10000.0, "active_d", false));
+        REQUIRE(pirate_repo.count_destroyed() == 0);
+        REQUIRE(pirate_repo.count_alive() == 3);
+
+        IShip* new_d = pirate_repo.get_ship_ptr("active_d");
+        c->take_damage(1000.0);
+        REQUIRE(pirate_repo.get_alive_ships() == std::vector<IShip*>{a, new_d});
+        c->set_health(40.0);
+        REQUIRE(pirate_repo.count_destroyed() == 0);
+        REQUIRE(pirate_repo.get_alive_ships() == std::vector<IShip*>{a, new_d, c});
+        REQUIRE(pirate_repo.get_weakest_ship() == c);
+
+        std::unique_ptr<IShip> copy = pirate_repo.read("active_a");
+        copy->take_damage(1000.0);
+        REQUIRE(pirate_repo.count_alive() == 3);
+
+        ShipRepository ship_repo;
+        ship_repo.create(std::make_unique<GuardShip>("Конвой", Military(), 50.0, 100.0, 10000.0, "active_convoy", true));
+        ship_repo.get_ship_ptr("active_convoy")->take_damage(1000.0);
+        REQUIRE(ship_repo.count_alive() == 0);
+        REQUIRE(ship_repo.count_destroyed() == 1);
+        ship_repo.clear();
+        REQUIRE(ship_repo.count_destroyed() == 0);
+    }
+    SECTION("Memory usage") {
+        ShipRepository ship_repo;
+        REQUIRE(ship_repo.memory_usage().total_bytes() == 0);
+        for (size_t i = 0; i < 20; ++i) {
+            std::string id = "memory_ship_with_a_long_identifier_" + std::to_string(i);
+            ship_repo.create(std::make_unique<GuardShip>("Конвой", Military("Барсуков Иван Петрович", "Майор"), 50.0, 100.0, 10000.0, id, true));
+        }
+        IShip* armed = ship_repo.get_ship_ptr("memory_ship_with_a_long_identifier_0");
+        size_t unarmed_bytes = armed->memory_usage();
+        REQUIRE(unarmed_bytes >= sizeof(GuardShip) + sizeof(ShipProfile));
+        dynamic_cast<GuardShip*>(armed)->set_weapon_in_place(PlaceForWeapon::bow, std::make_unique<Gun>());
+        REQUIRE(armed->memory_usage() >= unarmed_bytes + sizeof(Gun));
+
+        RepositoryMemoryUsage usage = ship_repo.memory_usage();
+        REQUIRE(usage.table.size == 20);
+        REQUIRE(usage.key_bytes > 0);
+        REQUIRE(usage.index_bytes >= 20 * sizeof(IShip*));
+        REQUIRE(usage.ship_bytes >= 20 * unarmed_bytes + sizeof(Gun));
+        REQUIRE(usage.total_bytes() == usage.table.reserved_bytes() + usage.key_bytes + usage.index_bytes + usage.ship_bytes);
+
+        for (size_t i = 1; i < 20; ++i) ship_repo.remove("memory_ship_with_a_long_identifier_" + std::to_string(i));
+        REQUIRE(ship_repo.memory_usage().table.tombstones == 19);
+        ship_repo.shrink_to_fit();
+        RepositoryMemoryUsage compacted = ship_repo.memory_usage();
+        REQUIRE(compacted.table.tombstones == 0);
+        REQUIRE(compacted.table.capacity == 1);
+        REQUIRE(compacted.total_bytes() < usage.total_bytes());
+        REQUIRE(ship_repo.get_ship_ptr("memory_ship_with_a_long_identifier_0") == armed);
+        REQUIRE(ship_repo.get_alive_ships() == std::vector<IShip*>{armed});
+
+        PirateRepository pirate_repo;
+        pirate_repo.create(std::make_unique<GuardShip>("Пират", Military(), 50.0, 100.0, 10000.0, "memory_pirate", false));
+        pirate_repo.shrink_to_fit();
+        REQUIRE(pirate_repo.memory_usage().table.capacity == 1);
+        REQUIRE(pirate_repo.memory_usage().ship_bytes == pirate_repo.get_ship_ptr("memory_pirate")->memory_usage());
+    }
 }
 
 TEST_CASE("Service") {
@@ -2298,9 +2777,13 @@ TEST_CASE("Service") {
         
         CargoInfoVisitor visitor;
         CargoService cargo_service(mission, ship_repo);
+        size_t version = mission.get_world_version();
         REQUIRE(!cargo_service.load_cargo(ship_repo.get_ship_ptr("I"), 100.0));
+        REQUIRE(!cargo_service.load_cargo(nullptr, 100.0));
+        REQUIRE(mission.get_world_version() == version);
         IShip* w_ship = ship_repo.get_ship_ptr("J");
         REQUIRE(cargo_service.load_cargo(w_ship, 100.0));
+        REQUIRE(mission.get_world_version() > version);
         w_ship->accept(&visitor);
         REQUIRE(std::abs(visitor.get_current_cargo() - 100.0) < EPS); 
 
@@ -2435,9 +2918,485 @@ TEST_CASE("Service") {
         REQUIRE(spawn_service.get_defeated_base_count() == 0);
         REQUIRE(spawn_service.get_total_pirates_spawned() == 2);
         REQUIRE(!spawn_service.are_all_bases_defeated());
+        size_t world_version = mission.get_world_version();
+        spawn_service.update(Vector(15.0, 0.0));
+        REQUIRE(mission.get_world_version() == world_version);
+
+        IShip* first_pirate = pirate_repo.get_ship_ptr(mission.get_pirate_base(0).spawned_pirate_ids[0]);
+        REQUIRE(first_pirate != nullptr);
+        REQUIRE(first_pirate->get_name() == "Пират");
+        REQUIRE(!first_pirate->is_convoy());
+        REQUIRE(dynamic_cast<DefaultGuard*>(first_pirate)->get_weapon_in_place(PlaceForWeapon::bow) != nullptr);
+
+        size_t pirate_counter = ShipIDGenerator::get_pirate_counter();
+        REQUIRE(spawn_service.spawn_pirates_at_position(Vector(100.0, 100.0), 2000) == 2000);
+        REQUIRE(ShipIDGenerator::get_pirate_counter() == pirate_counter + 2000);
+        REQUIRE(pirate_repo.count_alive() == 2002);
+        REQUIRE(spawn_service.get_total_pirates_spawned() == 2002);
+        bool all_armed = true;
+        for (IShip* pirate : pirate_repo.get_alive_ships()) {
+            if (pirate == first_pirate || pirate->get_position().x < 90.0) continue;
+            auto guard = dynamic_cast<DefaultGuard*>(pirate);
+            all_armed = all_armed && guard && guard->get_weapon_in_place(PlaceForWeapon::bow) && std::abs(pirate->get_position().x - 100.0) <= 5.0;
+        }
+        REQUIRE(all_armed);
+
+        std::vector<std::unique_ptr<IShip>> batch;
+        batch.push_back(std::make_unique<GuardShip>("Пират", Military(), 50.0, 100.0, 10000.0, "batch_new", false));
+        batch.push_back(first_pirate->clone());
+        REQUIRE_THROWS_AS(pirate_repo.create_batch(std::move(batch)), std::runtime_error);
+        REQUIRE(!pirate_repo.exists("batch_new"));
+        REQUIRE(pirate_repo.count() == 2002);
+        ShipIDGenerator::set_pirate_counter(pirate_counter);
+
+        PirateBase& second_base = mission.get_pirate_base(1);
+        REQUIRE_THROWS_AS(spawn_service.update(second_base.position), std::runtime_error);
+        REQUIRE(!second_base.is_activated);
+        REQUIRE(second_base.spawned_pirate_ids.empty());
+        REQUIRE(pirate_repo.count() == 2002);
+        ShipIDGenerator::set_pirate_counter(pirate_counter);
         spawn_service.clear_bases();
     }
 
+    SECTION("Target board") {
+        std::vector<std::unique_ptr<GuardShip>> ships;
+        std::vector<IShip*> ptrs;
+        for (size_t i = 0; i < 5; ++i) {
+            ships.push_back(std::make_unique<GuardShip>());
+            ships.back()->set_health(20.0 * (i + 1));
+            ships.back()->set_position(Vector(static_cast<double>(i), 0.0));
+            ptrs.push_back(ships.back().get());
+        }
+        ships[3]->set_health(0.0);
+        ptrs.push_back(nullptr);
+
+        TargetBoard board(ptrs);
+        REQUIRE(board.alive_count() == 4);
+        REQUIRE(board.weakest() == ships[0].get());
+        REQUIRE(board.strongest() == ships[4].get());
+
+        ships[4]->take_damage(90.0);
+        board.update(ships[4].get());
+        REQUIRE(board.weakest() == ships[4].get());
+        REQUIRE(board.strongest() == ships[2].get());
+        ships[4]->take_damage(10.0);
+        board.update(ships[4].get());
+        board.update(ships[3].get());
+        REQUIRE(board.alive_count() == 3);
+        REQUIRE(board.weakest() == ships[0].get());
+
+        ships[0]->take_damage(20.0);
+        REQUIRE(board.weakest() == ships[1].get());
+        ships[2]->take_damage(60.0);
+        REQUIRE(board.strongest() == ships[1].get());
+        ships[0]->set_health(20.0);
+        ships[2]->set_health(60.0);
+        board.update(ships[0].get());
+        board.update(ships[2].get());
+        REQUIRE(board.alive_count() == 3);
+
+        std::mt19937 rng(42);
+        for (size_t i = 0; i < 20; ++i) REQUIRE(board.random(rng)->is_alive());
+
+        AttackStrategyFactoryManager strategies;
+        GuardShip attacker;
+        attacker.set_position(Vector(1.9, 0.0));
+        REQUIRE(strategies.create_strategy("weakest")->select_target(&attacker, board) == ships[0].get());
+        REQUIRE(strategies.create_strategy("strongest")->select_target(&attacker, board) == ships[2].get());
+        REQUIRE(strategies.create_strategy("closest")->select_target(&attacker, board) == ships[2].get());
+        REQUIRE(strategies.create_strategy("random")->select_target(&attacker, board) != nullptr);
+
+        TargetBoard empty_board({});
+        REQUIRE(empty_board.weakest() == nullptr);
+        REQUIRE(empty_board.strongest() == nullptr);
+        REQUIRE(empty_board.random(rng) == nullptr);
+
+        std::vector<std::unique_ptr<GuardShip>> crowd;
+        std::vector<IShip*> crowd_ptrs;
+        for (size_t i = 0; i < 200; ++i) {
+            crowd.push_back(std::make_unique<GuardShip>("Пират", Military(), 50.0, 100.0, 10000.0, "TB" + std::to_string(i), false));
+            crowd_ptrs.push_back(crowd.back().get());
+        }
+        TargetBoard crowd_board(crowd_ptrs);
+        std::atomic<size_t> picks{0};
+        {
+            std::vector<std::jthread> readers;
+            for (size_t t = 0; t < 4; ++t) {
+                readers.emplace_back([&crowd_board, &picks, t]() {
+                    std::mt19937 local_rng(static_cast<unsigned>(t));
+                    while (crowd_board.alive_count() > 0) {
+                        for (IShip* ship : {crowd_board.weakest(), crowd_board.strongest(), crowd_board.random(local_rng)}) {
+                            if (ship) picks.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                });
+            }
+            for (auto& ship : crowd) {
+                ship->take_damage(ship->get_health());
+                crowd_board.update(ship.get());
+            }
+        }
+        REQUIRE(crowd_board.alive_count() == 0);
+        REQUIRE(crowd_board.weakest() == nullptr);
+        REQUIRE(crowd_board.strongest() == nullptr);
+        REQUIRE(crowd_board.alive_ships().empty());
+    }
+    SECTION("Splash damage") {
+        std::vector<std::unique_ptr<GuardShip>> ships;
+        std::vector<IShip*> ptrs;
+        for (size_t i = 0; i < 6; ++i) {
+            ships.push_back(std::make_unique<GuardShip>());
+            ships.back()->set_position(Vector(1.5 * static_cast<double>(i), -3.0));
+            ptrs.push_back(ships.back().get());
+        }
+        ptrs.push_back(nullptr);
+
+        SpatialGrid grid(ptrs, 2.0);
+        REQUIRE(grid.size() == 6);
+        REQUIRE(grid.query(Vector(3.0, -3.0), 1.5).size() == 3);
+        REQUIRE(grid.query(Vector(3.0, -3.0), 0.1).size() == 1);
+        REQUIRE(grid.query(Vector(-10.0, 10.0), 2.0).empty());
+        REQUIRE(grid.query(Vector(3.75, -3.0), 100.0).size() == 6);
+        REQUIRE_THROWS_AS(SpatialGrid(ptrs, 0.0), std::invalid_argument);
+
+        TargetBoard board(ptrs);
+        ships[1]->take_damage(ships[1]->get_health());
+        REQUIRE(board.alive_in_radius(Vector(0.0, -3.0), 1.5).size() == 1);
+
+        DamageService damage_service;
+        REQUIRE(std::abs(damage_service.calculate_splash_damage(100.0, 0.0, 2.0) - 100.0) < EPS);
+        REQUIRE(std::abs(damage_service.calculate_splash_damage(100.0, 0.5, 2.0) - 75.0) < EPS);
+        REQUIRE(damage_service.calculate_splash_damage(100.0, 2.0, 2.0) < EPS);
+        REQUIRE(damage_service.calculate_splash_damage(100.0, 1.0, 0.0) < EPS);
+        REQUIRE(damage_service.calculate_splash_damage(0.0, 1.0, 2.0) < EPS);
+    }
+    SECTION("Timed combat") {
+        CombatEventQueue queue;
+        REQUIRE(queue.empty());
+        REQUIRE_THROWS_AS(queue.next_time(), std::runtime_error);
+        GuardShip a, b;
+        queue.push(CombatEvent{0.5, &a, PlaceForWeapon::bow, CombatSide::convoy, 1});
+        queue.push(CombatEvent{0.0, &a, PlaceForWeapon::stern, CombatSide::convoy, 0});
+        queue.push(CombatEvent{0.5, &b, PlaceForWeapon::bow, CombatSide::pirates, 1});
+        queue.push(CombatEvent{1.0, &b, PlaceForWeapon::bow, CombatSide::pirates, 2});
+        REQUIRE(queue.size() == 4);
+        REQUIRE(std::abs(queue.next_time()) < EPS);
+
+        std::vector<CombatEvent> batch;
+        REQUIRE(queue.pop_batch(batch) == 1);
+        REQUIRE(batch[0].place == PlaceForWeapon::stern);
+        REQUIRE(queue.pop_batch(batch) == 2);
+        REQUIRE(batch[0].attacker == &a);
+        REQUIRE(batch[1].attacker == &b);
+        REQUIRE(queue.pop_batch(batch) == 1);
+        REQUIRE(std::abs(batch[0].time - 1.0) < EPS);
+        REQUIRE(queue.pop_batch(batch) == 0);
+
+        Mission mission("mission_timed", Military(), 100000.0, 1000.0, 50.0, 5, 5, Vector(), Vector(25.0, 25.0), 3.0, {});
+        ShipRepository convoy_repo;
+        PirateRepository pirate_repo;
+        auto convoy_ship = std::make_unique<GuardShip>("Конвой", Military(), 50.0, 1e6, 10000.0, "timed_convoy", true);
+        convoy_ship->set_weapon_in_place(PlaceForWeapon::bow, std::make_unique<Gun>("Пушка", 1.0, 3.0, 2, 3));
+        auto pirate_ship = std::make_unique<GuardShip>("Пират", Military(), 50.0, 1e6, 10000.0, "timed_pirate", false);
+        pirate_ship->set_weapon_in_place(PlaceForWeapon::bow, std::make_unique<Gun>("Пушка", 1.0, 3.0, 1, 50));
+        convoy_repo.create(std::move(convoy_ship));
+        pirate_repo.create(std::move(pirate_ship));
+
+        DamageService damage_service;
+        CombatService combat(mission, convoy_repo, pirate_repo, damage_service);
+        REQUIRE_THROWS_AS(combat.auto_attack_timed(0.0), std::invalid_argument);
+        REQUIRE(combat.auto_attack_timed(4.0) == 7);
+        REQUIRE(combat.auto_attack_timed(1.5) == 2);
+
+        for (size_t i = 0; i < 40; ++i) {
+            auto fleet_convoy = std::make_unique<GuardShip>("Конвой", Military(), 50.0, 1e6, 10000.0, "timed_convoy_" + std::to_string(i), true);
+            fleet_convoy->set_weapon_in_place(PlaceForWeapon::bow, std::make_unique<Gun>("Пушка", 1.0, 3.0, 1, 2));
+            auto fleet_pirate = std::make_unique<GuardShip>("Пират", Military(), 50.0, 1e6, 10000.0, "timed_pirate_" + std::to_string(i), false);
+            fleet_pirate->set_weapon_in_place(PlaceForWeapon::stern, std::make_unique<Gun>("Пушка", 1.0, 3.0, 1, 2));
+            convoy_repo.create(std::move(fleet_convoy));
+            pirate_repo.create(std::move(fleet_pirate));
+        }
+        REQUIRE(combat.auto_attack_timed(10.0) == 40 * 2 * 2 + 10);
+    }
+    SECTION("Engagement") {
+        Mission mission("mission_engagement", Military(), 100000.0, 1000.0, 50.0, 5, 5, Vector(), Vector(25.0, 25.0), 3.0, {});
+        ShipRepository convoy_repo;
+        PirateRepository pirate_repo;
+        auto convoy_ship = std::make_unique<GuardShip>("Конвой", Military(), 50.0, 1e6, 10000.0, "engagement_convoy", true);
+        convoy_ship->set_weapon_in_place(PlaceForWeapon::bow, std::make_unique<Gun>("Пушка", 1.0, 3.0, 2, 1, 5000.0, 1.0));
+        auto pirate_ship = std::make_unique<GuardShip>("Пират", Military(), 50.0, 1e6, 10000.0, "engagement_pirate", false, Vector(100.0, 0.0));
+        pirate_ship->set_weapon_in_place(PlaceForWeapon::bow, std::make_unique<Gun>("Пушка", 1.0, 3.0, 2, 1, 5000.0, 1.0));
+        convoy_repo.create(std::move(convoy_ship));
+        pirate_repo.create(std::move(pirate_ship));
+
+        DamageService damage_service;
+        CombatService combat(mission, convoy_repo, pirate_repo, damage_service);
+        EngagementDTO summary = combat.resolve_engagement();
+        REQUIRE(summary.stalemate);
+        REQUIRE(summary.rounds == 0);
+        REQUIRE(summary.shots == 0);
+
+        pirate_repo.get_ship_ptr("engagement_pirate")->set_position(Vector());
+        summary = combat.resolve_engagement();
+        REQUIRE(summary.stalemate);
+        REQUIRE(summary.rounds == 1);
+        REQUIRE(summary.shots == 2);
+        REQUIRE(summary.damage_dealt > 0.0);
+        REQUIRE(summary.convoy_alive == 1);
+        REQUIRE(summary.pirates_alive == 1);
+
+        auto hunter = std::make_unique<GuardShip>("Конвой", Military(), 50.0, 100.0, 10000.0, "engagement_hunter", true);
+        hunter->set_weapon_in_place(PlaceForWeapon::bow, std::make_unique<Gun>("Пушка", 1e7, 3.0, 2, 5, 5000.0, 1.0));
+        convoy_repo.create(std::move(hunter));
+        summary = combat.resolve_engagement(true);
+        REQUIRE(!summary.stalemate);
+        REQUIRE(summary.rounds == 1);
+        REQUIRE(summary.shots == 1);
+        REQUIRE(summary.pirates_alive == 0);
+        REQUIRE(summary.convoy_alive == 2);
+    }
+    SECTION("Combat telemetry") {
+        Mission mission("mission_telemetry", Military(), 100000.0, 1000.0, 50.0, 5, 5, Vector(), Vector(25.0, 25.0), 3.0, {});
+        ShipRepository convoy_repo;
+        PirateRepository pirate_repo;
+        auto convoy_ship = std::make_unique<GuardShip>("Конвой", Military(), 50.0, 1000.0, 10000.0, "telemetry_convoy", true);
+        convoy_ship->set_weapon_in_place(PlaceForWeapon::bow, std::make_unique<Gun>("Пушка", 1e7, 3.0, 2, 5, 5000.0, 1.0));
+        auto pirate_ship = std::make_unique<GuardShip>("Пират", Military(), 50.0, 100.0, 10000.0, "telemetry_pirate", false);
+        pirate_ship->set_weapon_in_place(PlaceForWeapon::bow, std::make_unique<Gun>("Пушка", 10.0, 3.0, 2, 5, 5000.0, 1.0));
+        convoy_repo.create(std::move(convoy_ship));
+        pirate_repo.create(std::move(pirate_ship));
+
+        DamageService damage_service;
+        CombatService combat(mission, convoy_repo, pirate_repo, damage_service);
+        combat.auto_attack_all_sequential();
+        combat.auto_attack_all_sequential();
+        REQUIRE(combat.get_combat_rounds().size() == 1);
+
+        const CombatRoundDTO& round = combat.get_combat_rounds()[0];
+        REQUIRE(round.round == 1);
+        REQUIRE(round.shots == 1);
+        REQUIRE(round.hits == 1);
+        REQUIRE(round.misses == 0);
+        REQUIRE(round.kills == 1);
+        REQUIRE(std::abs(round.convoy_damage - 100.0) < EPS);
+        REQUIRE(std::abs(round.pirate_damage) < EPS);
+        REQUIRE(round.overkill > 1e6);
+        REQUIRE(round.ammo_used == std::vector<std::pair<std::string, size_t>>{{"gun", 1}});
+
+        CombatRoundDTO totals = combat.get_combat_totals();
+        REQUIRE(totals.round == 1);
+        REQUIRE(totals.shots == 1);
+
+        std::ostringstream csv;
+        combat.write_combat_csv(csv);
+        std::string text = csv.str();
+        REQUIRE(text.starts_with("round,shots,hits,misses,criticals,kills,overkill,convoy_damage,pirate_damage,cargo_lost,ammo_gun\n1,1,1,0,"));
+        REQUIRE(text.ends_with(",1\n"));
+
+        combat.clear_combat_telemetry();
+        REQUIRE(combat.get_combat_rounds().empty());
+
+        CombatTelemetry telemetry;
+        REQUIRE_THROWS_AS(telemetry.slot(CombatTelemetry::slot_count), std::out_of_range);
+        HitResult miss;
+        miss.fired = true;
+        telemetry.slot(0).record_shot("rocket", miss, CombatSide::pirates);
+        telemetry.slot(5).record_shot("rocket", miss, CombatSide::pirates);
+        telemetry.slot(7).record_shot("gun", miss, CombatSide::convoy);
+        const CombatRoundDTO& reduced = telemetry.end_round();
+        REQUIRE(reduced.shots == 3);
+        REQUIRE(reduced.misses == 3);
+        REQUIRE(reduced.ammo_used == std::vector<std::pair<std::string, size_t>>{{"gun", 1}, {"rocket", 2}});
+        REQUIRE(telemetry.end_round().shots == 0);
+        REQUIRE_THROWS_AS(telemetry.worker_slot(CombatTelemetry::worker_slot_count), std::out_of_range);
+        REQUIRE(&telemetry.worker_slot(CombatTelemetry::worker_slot_count - 1) == &telemetry.slot(CombatTelemetry::slot_count - 1));
+
+        telemetry.set_enabled(false);
+        telemetry.worker_slot(0).record_shot("gun", miss, CombatSide::convoy);
+        CombatRoundDTO quiet = telemetry.end_round();
+        REQUIRE(quiet.round == 0);
+        REQUIRE(quiet.shots == 0);
+        REQUIRE(telemetry.get_rounds().size() == 2);
+        telemetry.set_enabled(true);
+        REQUIRE(telemetry.end_round().shots == 0);
+
+        REQUIRE_THROWS_AS(CombatTelemetry(0), std::invalid_argument);
+        CombatTelemetry bounded(3);
+        for (size_t i = 0; i < 5; ++i) bounded.end_round();
+        REQUIRE(bounded.get_rounds().size() == 3);
+        REQUIRE(bounded.get_rounds().front().round == 3);
+        REQUIRE(bounded.get_rounds().back().round == 5);
+        REQUIRE(bounded.get_totals().round == 3);
+    }
+    SECTION("Combat telemetry disabled") {
+        auto run = [](bool enabled) {
+            Mission mission("mission_quiet", Military(), 100000.0, 1000.0, 50.0, 5, 5, Vector(), Vector(25.0, 25.0), 3.0, {});
+            ShipRepository convoy_repo;
+            PirateRepository pirate_repo;
+            for (size_t i = 0; i < 20; ++i) {
+                auto convoy_ship = std::make_unique<GuardShip>("Конвой", Military(), 50.0, 1e9, 10000.0, "quiet_convoy_" + std::to_string(i), true);
+                convoy_ship->set_weapon_in_place(PlaceForWeapon::bow, std::make_unique<Gun>("Пушка", 1.0, 100.0, 10, 1000, 5000.0, 1.0));
+                convoy_repo.create(std::move(convoy_ship));
+                auto pirate_ship = std::make_unique<GuardShip>("Пират", Military(), 50.0, 1e9, 10000.0, "quiet_pirate_" + std::to_string(i), false);
+                pirate_ship->set_weapon_in_place(PlaceForWeapon::bow, std::make_unique<Gun>("Пушка", 1.0, 100.0, 10, 1000, 5000.0, 1.0));
+                pirate_repo.create(std::move(pirate_ship));
+            }
+            DamageService damage_service;
+            CombatService combat(mission, convoy_repo, pirate_repo, damage_service);
+            combat.set_combat_telemetry_enabled(enabled);
+
+            size_t shots = combat.auto_attack_timed(10.0);
+            EngagementDTO summary = combat.resolve_engagement(true, 3);
+            REQUIRE(combat.get_combat_rounds().size() == (enabled ? 4 : 0));
+            REQUIRE(combat.get_combat_totals().shots == (enabled ? shots + summary.shots : 0));
+            return std::make_pair(shots, summary);
+        };
+
+        auto [enabled_shots, enabled_summary] = run(true);
+        auto [disabled_shots, disabled_summary] = run(false);
+        REQUIRE(enabled_shots == 4000);
+        REQUIRE(disabled_shots == enabled_shots);
+        REQUIRE(enabled_summary.rounds == 3);
+        REQUIRE(disabled_summary.rounds == 3);
+        REQUIRE(disabled_summary.shots == enabled_summary.shots);
+        REQUIRE(disabled_summary.shots == 120);
+        REQUIRE(disabled_summary.damage_dealt > 0.0);
+    }
+    SECTION("Hit resolver") {
+        WarShip attacker("Атакующий", Military(), 40.0, 200.0, 25000.0, "hit_attacker");
+        attacker.set_weapon_in_place(PlaceForWeapon::bow, std::make_unique<Gun>("Пушка", 50.0, 3.0, 2, 2, 5000.0, 1.0));
+        TransportShip target("Цель", Military(), 30.0, 150.0, 15000.0, "hit_target");
+        target.set_cargo(600.0);
+        DamageService damage_service;
+
+        HitResult hit = HitResolver::resolve(attacker, PlaceForWeapon::bow, &target, 0.0, damage_service, true);
+        REQUIRE(hit.fired);
+        REQUIRE(hit.hit);
+        REQUIRE(!hit.killed);
+        REQUIRE(std::abs(hit.damage - (hit.critical ? 75.0 : 50.0)) < EPS);
+        REQUIRE(std::abs(hit.health_lost - hit.damage) < EPS);
+        REQUIRE(std::abs(target.get_health() - (150.0 - hit.damage)) < EPS);
+        REQUIRE(std::abs(hit.cargo_lost - 600.0 * hit.damage / 150.0) < EPS);
+        REQUIRE(std::abs(target.get_cargo() - (600.0 - hit.cargo_lost)) < EPS);
+        REQUIRE(attacker.get_weapon_in_place(PlaceForWeapon::bow)->get_current_ammo() == 1);
+
+        REQUIRE(!HitResolver::resolve(attacker, PlaceForWeapon::bow, &target, 5.0, damage_service, true).fired);
+        REQUIRE(!HitResolver::resolve(attacker, PlaceForWeapon::stern, &target, 0.0, damage_service, true).fired);
+        REQUIRE(attacker.get_weapon_in_place(PlaceForWeapon::bow)->get_current_ammo() == 1);
+
+        double cargo_before = target.get_cargo();
+        hit = HitResolver::apply_damage(&target, 1000.0, false);
+        REQUIRE(hit.killed);
+        REQUIRE(!target.is_alive());
+        REQUIRE(std::abs(hit.cargo_lost) < EPS);
+        REQUIRE(std::abs(target.get_cargo() - cargo_before) < EPS);
+    }
+    SECTION("Targeting policy") {
+        AttackStrategyFactoryManager strategies;
+        auto weakest = strategies.create_strategy("weakest");
+        auto closest = strategies.create_strategy("closest");
+        REQUIRE(std::holds_alternative<WeakestTargeting>(strategies.create_targeting("weakest", *weakest)));
+        REQUIRE(std::holds_alternative<ClosestTargeting>(strategies.create_targeting("closest", *closest)));
+        REQUIRE(std::holds_alternative<DynamicTargeting>(strategies.create_targeting("unknown", *weakest)));
+
+        GuardShip attacker;
+        GuardShip target;
+        REQUIRE(!DamageWeaponChoice{}.select_weapon_place(&attacker, nullptr, &target, 0.0).has_value());
+        REQUIRE(DPSWeaponChoice{}.select_weapon_place(&attacker, &attacker, &target, 0.0) == PlaceForWeapon::bow);
+        TargetBoard board({&target});
+        TargetingPolicy policy = strategies.create_targeting("unknown", *closest);
+        REQUIRE(std::visit([&](const auto& t) { return t.select_target(&attacker, board); }, policy) == &target);
+    }
+    SECTION("Cargo distribution") {
+        std::vector<CargoSlot> slots = {
+            {100.0, 0.0, 0.15, 150.0},
+            {250.0, 0.0, 0.1, 200.0},
+            {500.0, 400.0, 0.1, 100.0}
+        };
+        REQUIRE(!CargoDistributionEngine::distribute_evenly(slots, 500.0).has_value());
+        auto even = CargoDistributionEngine::distribute_evenly(slots, 240.0);
+        REQUIRE(even.has_value());
+        REQUIRE(std::abs((*even)[0] - 80.0) < EPS);
+        REQUIRE(std::abs((*even)[1] - 80.0) < EPS);
+        REQUIRE(std::abs((*even)[2] - 80.0) < EPS);
+        even = CargoDistributionEngine::distribute_evenly(slots, 360.0);
+        REQUIRE(std::abs((*even)[0] - 100.0) < EPS);
+        REQUIRE(std::abs((*even)[1] - 160.0) < EPS);
+        REQUIRE(std::abs((*even)[2] - 100.0) < EPS);
+
+        auto fast = CargoDistributionEngine::distribute_for_max_speed(slots, 200.0);
+        REQUIRE(fast.has_value());
+        REQUIRE(std::abs((*fast)[0] + (*fast)[1] + (*fast)[2] - 200.0) < EPS);
+        REQUIRE(std::abs((*fast)[0]) < EPS);
+        REQUIRE(std::abs((*fast)[2]) < EPS);
+        REQUIRE(std::abs((*fast)[1] - 200.0) < EPS);
+
+        auto limited = CargoDistributionEngine::distribute_for_max_speed(slots, 300.0);
+        REQUIRE(std::abs((*limited)[2]) < EPS);
+        REQUIRE(slots[0].speed_with((*limited)[0]) >= slots[2].speed_with(0.0));
+        REQUIRE(slots[1].speed_with((*limited)[1]) >= slots[2].speed_with(0.0));
+
+        std::vector<CargoSlot> pair = {{100.0, 0.0, 0.5, 100.0}, {100.0, 0.0, 0.5, 80.0}};
+        auto balanced = CargoDistributionEngine::distribute_for_max_speed(pair, 100.0);
+        REQUIRE(std::abs((*balanced)[0] - 200.0 / 3) < 1e-6);
+        REQUIRE(std::abs((*balanced)[1] - 100.0 / 3) < 1e-6);
+        REQUIRE(std::abs(pair[0].speed_with((*balanced)[0]) - pair[1].speed_with((*balanced)[1])) < 1e-6);
+
+        std::vector<CargoSlot> fleet;
+        double capacity = 0.0;
+        for (size_t i = 0; i < 20000; ++i) {
+            fleet.push_back({500.0 + i % 7 * 100.0, i % 3 * 50.0, 0.05 + i % 5 * 0.02, 20.0 + i % 11});
+            capacity += fleet.back().available();
+        }
+        auto fleet_loads = CargoDistributionEngine::distribute_for_max_speed(fleet, capacity / 2);
+        REQUIRE(fleet_loads.has_value());
+        double loaded = 0.0;
+        bool within_capacity = true;
+        for (size_t i = 0; i < fleet.size(); ++i) {
+            within_capacity = within_capacity && (*fleet_loads)[i] >= 0.0 && (*fleet_loads)[i] <= fleet[i].available() + EPS;
+            loaded += (*fleet_loads)[i];
+        }
+        REQUIRE(within_capacity);
+        REQUIRE(std::abs(loaded - capacity / 2) < 1e-3);
+    }
+    SECTION("Catalog") {
+        ShipCatalog ship_catalog(std::make_unique<ShipFactoryManager>());
+        std::string_view id = "guard_heavy";
+        REQUIRE(ship_catalog.find_template_by_id(id)->cost == 40000.0);
+        REQUIRE(ship_catalog.find_template_by_id("missing") == nullptr);
+        REQUIRE(ship_catalog.count_by_type("transport") == 3);
+        REQUIRE(ship_catalog.find_templates_by_type("war").size() == 2);
+        REQUIRE(ship_catalog.find_templates_by_type("missing").empty());
+        auto affordable = ship_catalog.find_affordable_templates(20000.0);
+        REQUIRE(affordable.size() == 3);
+        REQUIRE(affordable[0]->id == "transport_small");
+        REQUIRE(affordable[2]->id == "transport_medium");
+        REQUIRE(ship_catalog.find_affordable_templates(5000.0).empty());
+        REQUIRE(std::abs(ship_catalog.get_min_cost() - 10000.0) < EPS);
+        REQUIRE(std::abs(ship_catalog.get_max_cost() - 45000.0) < EPS);
+
+        ShipTemplate cheap_guard = *ship_catalog.find_template_by_id("guard_fast");
+        cheap_guard.id = "guard_cheap";
+        cheap_guard.cost = 5000.0;
+        ship_catalog.add_template(cheap_guard);
+        REQUIRE_THROWS(ship_catalog.add_template(cheap_guard));
+        REQUIRE(ship_catalog.count_by_type("guard") == 4);
+        REQUIRE(ship_catalog.find_affordable_templates(5000.0).size() == 1);
+        REQUIRE(std::abs(ship_catalog.get_min_cost() - 5000.0) < EPS);
+
+        WeaponCatalog weapon_catalog(std::make_unique<WeaponFactoryManager>());
+        auto strong = weapon_catalog.find_by_min_damage(30.0);
+        REQUIRE(strong.size() == 3);
+        REQUIRE(strong[0]->id == "rocket_light");
+        REQUIRE(strong[2]->id == "rocket_heavy");
+        auto long_range = weapon_catalog.find_by_min_range(8.0);
+        REQUIRE(long_range.size() == 4);
+        REQUIRE(long_range[0]->id == "gun_medium");
+        REQUIRE(weapon_catalog.find_by_min_range(13.0).empty());
+        REQUIRE(std::abs(weapon_catalog.get_max_damage() - 50.0) < EPS);
+        REQUIRE(std::abs(weapon_catalog.get_max_range() - 12.0) < EPS);
+        REQUIRE(weapon_catalog.find_affordable_templates(5000.0).size() == 2);
+    }
     SECTION("Purchase service") {
         std::vector<PirateBase> p_bases;
         PirateBase pb1, pb2;
@@ -2511,6 +3470,93 @@ TEST_CASE("Service") {
         REQUIRE(purchase_service.install_weapon("C", PlaceForWeapon::bow, "gun_medium"));
         REQUIRE(std::abs(mission.get_current_budget() - 3000.0) < EPS);
     } 
+
+    SECTION("Bulk purchase") {
+        Mission mission("mission_1", Military("Барсуков", "Майор"), 100000.0, 1000.0, 50.0, 10, 10, Vector(), Vector(50.0, 0.0), 5.0, {});
+
+        ShipIDGenerator::reset();
+        PirateRepository pirate_repo;
+        ShipRepository ship_repo;
+        ShipCatalog ship_catalog(std::make_unique<ShipFactoryManager>());
+        WeaponCatalog weapon_catalog(std::make_unique<WeaponFactoryManager>());
+        PurchaseService purchase_service(mission, ship_repo, pirate_repo, ship_catalog, weapon_catalog);
+
+        std::vector<Vector> positions;
+        for (size_t i = 0; i < 7; ++i) positions.emplace_back(i * 1.0, 0.0);
+        REQUIRE(purchase_service.buy_ships("guard_fast", positions).empty());
+        REQUIRE(std::abs(mission.get_current_budget() - 100000.0) < EPS);
+        REQUIRE(ship_repo.count() == 0);
+        REQUIRE(ShipIDGenerator::get_convoy_counter() == 0);
+
+        positions.resize(5);
+        std::vector<std::string> ids = purchase_service.buy_ships("guard_fast", positions);
+        REQUIRE(ids.size() == 5);
+        REQUIRE(ship_repo.count() == 5);
+        REQUIRE(std::abs(mission.get_current_budget() - 25000.0) < EPS);
+        REQUIRE(ship_repo.get_ship_ptr(ids[4])->get_position() == Vector(4.0, 0.0));
+
+        size_t counter = ShipIDGenerator::get_convoy_counter();
+        ShipIDGenerator::set_convoy_counter(0);
+        REQUIRE(purchase_service.buy_ships("guard_fast", {Vector()}).empty());
+        REQUIRE(ShipIDGenerator::get_convoy_counter() == 0);
+        REQUIRE(std::abs(mission.get_current_budget() - 25000.0) < EPS);
+        REQUIRE(ship_repo.count() == 5);
+        ShipIDGenerator::set_convoy_counter(counter);
+
+        REQUIRE(!purchase_service.install_weapons(ids, PlaceForWeapon::bow, "rocket_light"));
+        REQUIRE(!purchase_service.install_weapons({ids[0], "missing"}, PlaceForWeapon::bow, "gun_light"));
+        REQUIRE(!purchase_service.install_weapons({ids[0], ids[0]}, PlaceForWeapon::bow, "gun_light"));
+        REQUIRE(std::abs(mission.get_current_budget() - 25000.0) < EPS);
+        for (const auto& id : ids) REQUIRE(!purchase_service.has_weapon_in_place(id, PlaceForWeapon::bow));
+
+        REQUIRE(purchase_service.install_weapons(ids, PlaceForWeapon::bow, "gun_light"));
+        REQUIRE(std::abs(mission.get_current_budget() - 10000.0) < EPS);
+        for (const auto& id : ids) REQUIRE(purchase_service.has_weapon_in_place(id, PlaceForWeapon::bow));
+        REQUIRE(!purchase_service.install_weapons({ids[0]}, PlaceForWeapon::bow, "gun_light"));
+        REQUIRE(std::abs(mission.get_current_budget() - 10000.0) < EPS);
+    }
+
+    SECTION("State service") {
+        Mission mission("mission_1", Military("Барсуков", "Майор"), 100000.0, 1000.0, 50.0, 100, 100, Vector(), Vector(50.0, 0.0), 5.0, {});
+
+        ShipIDGenerator::reset();
+        PirateRepository pirate_repo;
+        ShipRepository ship_repo;
+        ShipFactoryManager manager;
+        for (size_t i = 0; i < 40; ++i) {
+            std::unique_ptr<IShip> ship = manager.create_ship("war", "Титаник", Military("Барсуков", "Майор"), 150.0, 150.0, 1000.0, true, 100.0, Vector(i * 1.0, 0.0));
+            WarShip* war_ship = dynamic_cast<WarShip*>(ship.get());
+            war_ship->set_weapon_in_place(PlaceForWeapon::bow, std::make_unique<Gun>("Пушка", 20.0, 5.0, 2, 10, 100.0, 0.9));
+            ship_repo.create(std::move(ship));
+        }
+        for (size_t i = 0; i < 25; ++i) {
+            pirate_repo.create(manager.create_ship("guard", false));
+        }
+
+        MissionDTOMapper mission_dto_mapper;
+        MissionMapper mission_mapper;
+        ShipDTOMapperManager ship_dto_mapper_manager;
+        ShipMapperManager ship_mapper_manager;
+        YamlStateService state_service(mission, ship_repo, pirate_repo, mission_dto_mapper, mission_mapper, ship_dto_mapper_manager, ship_mapper_manager);
+
+        const std::string path = "state_service_test.yaml";
+        REQUIRE(state_service.save(path));
+        ship_repo.clear();
+        pirate_repo.clear();
+        REQUIRE(state_service.load(path));
+        std::remove(path.c_str());
+
+        REQUIRE(ship_repo.count() == 40);
+        REQUIRE(pirate_repo.count() == 25);
+        REQUIRE(ship_repo.get_ship_ptr("A") != nullptr);
+        REQUIRE(ship_repo.get_ship_ptr("AN") != nullptr);
+        REQUIRE(pirate_repo.get_ship_ptr("25") != nullptr);
+        WarShip* loaded = dynamic_cast<WarShip*>(ship_repo.get_ship_ptr("J"));
+        REQUIRE(loaded != nullptr);
+        REQUIRE(std::abs(loaded->get_position().x - 9.0) < EPS);
+        REQUIRE(loaded->get_weapon_in_place(PlaceForWeapon::bow) != nullptr);
+        REQUIRE(std::abs(loaded->get_weapon_in_place(PlaceForWeapon::bow)->get_damage() - 20.0) < EPS);
+    }
 }
 
 TEST_CASE("All work") {
@@ -2521,9 +3567,13 @@ TEST_CASE("All work") {
             Loader loader;
             size_t convoy_count = 4, pirate_count = 4;
             auto presenter = loader.create_presenter_test(convoy_count, pirate_count);
+            const std::vector<ShipDTO>& cached_convoy = presenter->get_convoy_ships();
+            REQUIRE(&cached_convoy == &presenter->get_convoy_ships());
+            REQUIRE(cached_convoy.empty());
             for (size_t i = 0; i < convoy_count; ++i) {
                 presenter->purchase_ship("war_light");
             }
+            REQUIRE(presenter->get_convoy_ships().size() == convoy_count);
             presenter->auto_distribute_cargo();
 
             std::vector<ShipDTO> shoot_ships = presenter->get_attack_ships();
@@ -2685,4 +3735,69 @@ TEST_CASE("All work") {
             REQUIRE(std::abs(presenter->get_convoy_center().y) < 3.0);
         }
     }
+}
+
+TEST_CASE("Latency histogram") {
+    SECTION("Percentiles") {
+        LatencyHistogram histogram;
+        REQUIRE(histogram.count() == 0);
+        REQUIRE(histogram.percentile(99.0) == 0);
+        for (uint64_t i = 1; i <= 1000; ++i) histogram.record(i * 1000);
+        REQUIRE(histogram.count() == 1000);
+        REQUIRE(histogram.max() == 1000000);
+        REQUIRE(std::abs(histogram.mean() - 500500.0) < EPS);
+        REQUIRE(histogram.percentile(50.0) >= 500000);
+        REQUIRE(histogram.percentile(50.0) <= 500000 * 17 / 16);
+        REQUIRE(histogram.percentile(99.0) >= 990000);
+        REQUIRE(histogram.percentile(99.0) <= 1000000);
+        REQUIRE(histogram.percentile(100.0) == 1000000);
+
+        LatencyHistogram small;
+        for (uint64_t i = 0; i < 10; ++i) small.record(7);
+        REQUIRE(small.percentile(50.0) == 7);
+        small.clear();
+        REQUIRE(small.count() == 0);
+        REQUIRE(small.max() == 0);
+    }
+    SECTION("Concurrent record") {
+        LatencyHistogram histogram;
+        {
+            std::vector<std::jthread> threads;
+            for (uint64_t t = 1; t <= 4; ++t) {
+                threads.emplace_back([&histogram, t]() {
+                    for (uint64_t i = 0; i < 1000; ++i) histogram.record(t * 100);
+                });
+            }
+        }
+        REQUIRE(histogram.count() == 4000);
+        REQUIRE(histogram.max() == 400);
+    }
+    SECTION("Instrumented presenter") {
+        REQUIRE_THROWS_AS(InstrumentedPresenter(nullptr), std::invalid_argument);
+
+        ShipIDGenerator::reset();
+        Loader loader;
+        InstrumentedPresenter presenter(loader.create_presenter_test(2, 2));
+        REQUIRE(presenter.purchase_ships("war_light", 2));
+        const std::vector<ShipDTO>& convoy = presenter.get_convoy_ships();
+        REQUIRE(&convoy == &presenter.get_convoy_ships());
+        REQUIRE(convoy.size() == 2);
+        presenter.auto_distribute_cargo();
+
+        REQUIRE(presenter.get_histogram("purchase_ships").count() == 1);
+        REQUIRE(presenter.get_histogram("get_convoy_ships").count() == 2);
+        REQUIRE(presenter.get_histogram("save_game").count() == 0);
+        REQUIRE_THROWS_AS(presenter.get_histogram("unknown"), std::invalid_argument);
+
+        std::ostringstream out;
+        presenter.write_report(out);
+        std::string report = out.str();
+        REQUIRE(report.starts_with("method"));
+        REQUIRE(report.find("p99,us") != std::string::npos);
+        REQUIRE(report.find("get_convoy_ships") != std::string::npos);
+        REQUIRE(report.find("save_game") == std::string::npos);
+
+        presenter.clear_histograms();
+        REQUIRE(presenter.get_histogram("get_convoy_ships").count() == 0);
+    }
 }
\ No newline at end of file
@@ -1,6 +1,6 @@
 #include "ViewConsole.hpp"
 
-ViewConsole::ViewConsole(std::unique_ptr<Presenter> presenter) : presenter_(std::move(presenter)) {}
+ViewConsole::ViewConsole(std::unique_ptr<IPresenter> presenter) : presenter_(std::move(presenter)) {}
 
 void process_error(std::istream& in, const std::string& error) {
     if (in.eof()) {
@@ -50,10 +50,10 @@ void ViewConsole::save_or_new_game() {
         }
         case 2: {
             presenter_->load_game("saved_game.yaml");
-            auto ships = presenter_->get_convoy_ships();
+            FleetSnapshot ships = presenter_->get_convoy_snapshot();
             std::string max_char = "A";
-            for (const auto& ship : ships) {
-                if (max_char < ship.id) max_char = ship.id;
+            for (uint32_t id : ships.id) {
+                if (max_char < ships.str(id)) max_char = ships.str(id);
             }
 
             size_t index = 0;
@@ -95,15 +95,14 @@ void ViewConsole::purchase_ships() {
     size_t available_ships_cnt = presenter_->get_mission().max_convoy_ships - presenter_->count_alive_convoy_ships();
     std::vector<ShipTemplate> templates = presenter_->get_available_ships();
     LookupTable<std::string, size_t> shop_cart;
-    std::vector<ShipDTO> ships = presenter_->get_convoy_ships();
-    for (const auto& ship_dto : ships) {
+    FleetSnapshot ships = presenter_->get_convoy_snapshot();
+    for (uint32_t name : ships.name) {
         for (const auto& temp : templates) {
-            if (temp.display_name == ship_dto.name) ++shop_cart[temp.id];
+            if (temp.display_name == ships.str(name)) ++shop_cart[temp.id];
         }
     }
     while (true) {
         std::cout << "------------------Корзина-------------------\n";
-        ships = presenter_->get_convoy_ships();
         for (const auto& temp : templates) {
             if (shop_cart[temp.id] > 0) {
                 std::cout << "\t" << temp.id << ": " << shop_cart[temp.id] << "\n";
@@ -635,11 +634,12 @@ void ViewConsole::mission_sequential() {
                 }
             }
 
-            while (presenter_->count_alive_convoy_ships() != 0 && presenter_->count_alive_pirate_ships() != 0) {
-                presenter_->auto_combat_sequential();
-                std::cout << "\nКонвой:" << presenter_->convoy_info();
-                std::cout << "\nПираты:" << presenter_->pirate_info();
-            }
+            EngagementDTO engagement = presenter_->resolve_combat(false);
+            std::cout << "\nРаундов: " << engagement.rounds << ", выстрелов: " << engagement.shots
+                << ", урон: " << engagement.damage_dealt << ", потеряно груза: " << engagement.cargo_lost << "\n";
+            if (engagement.stalemate) std::cout << "Бой остановлен: ни один корабль не может выстрелить\n";
+            std::cout << "\nКонвой:" << presenter_->convoy_info();
+            std::cout << "\nПираты:" << presenter_->pirate_info();
 
             if (presenter_->count_alive_convoy_ships() == 0) break;
             else {
@@ -704,11 +704,12 @@ void ViewConsole::mission_parallel() {
                 }
             }
 
-            while (presenter_->count_alive_convoy_ships() != 0 && presenter_->count_alive_pirate_ships() != 0) {
-                presenter_->auto_combat_parallel();
-                std::cout << "\nКонвой:" << presenter_->convoy_info();
-                std::cout << "\nПираты:" << presenter_->pirate_info();
-            }
+            EngagementDTO engagement = presenter_->resolve_combat(true);
+            std::cout << "\nРаундов: " << engagement.rounds << ", выстрелов: " << engagement.shots
+                << ", урон: " << engagement.damage_dealt << ", потеряно груза: " << engagement.cargo_lost << "\n";
+            if (engagement.stalemate) std::cout << "Бой остановлен: ни один корабль не может выстрелить\n";
+            std::cout << "\nКонвой:" << presenter_->convoy_info();
+            std::cout << "\nПираты:" << presenter_->pirate_info();
 
             if (presenter_->count_alive_convoy_ships() == 0) break;
             else {
@@ -13,7 +13,7 @@
  */
 class ViewConsole {
     private:
-        std::unique_ptr<Presenter> presenter_; ///< Указатель на презентер
+        std::unique_ptr<IPresenter> presenter_; ///< Указатель на презентер
 
         /**
          * @brief Загрузить игру или новая игра
@@ -54,7 +54,7 @@ class ViewConsole {
          * @brief Конструктор
          * @param presenter Указатель на презентер
          */
-        ViewConsole(std::unique_ptr<Presenter> presenter);
+        ViewConsole(std::unique_ptr<IPresenter> presenter);
         
         /**
          * @brief Запускает консольное приложение
@@ -0,0 +1,20 @@
+/**
+ * @file ShipVariant.hpp
+ * @brief Заголовочный файл, содержащий определение закрытого представления кораблей через std::variant
+ */
+
+#pragma once
+
+#include <variant>
+
+class GuardShip;
+class TransportShip;
+class WarShip;
+
+/**
+ * @brief Указатель на корабль с известным конкретным типом
+ * @details Альтернатива IShipVisitor для горячих путей: тип корабля определяется одним вызовом IShip::as_variant(),
+ * после чего std::visit выбирает обработчик без виртуальных вызовов, и обработчики могут встраиваться.
+ * Обобщенный обработчик с if constexpr заменяет одинаковые тела visit для GuardShip и WarShip.
+ */
+using ShipVariant = std::variant<TransportShip*, GuardShip*, WarShip*>;
@@ -2,12 +2,6 @@
 #include "../../entity/ship/Concrete/TransportShip.hpp"
 #include "../../entity/ship/Concrete/GuardShip.hpp"
 #include "../../entity/ship/Concrete/WarShip.hpp"
-#include <vector>
-
-double PlaceForDPSVisitor::calculate_dps(IWeapon* weapon) const {
-    if (!weapon) return 0.0;
-    return weapon->get_damage() * weapon->get_fire_rate();
-}
 
 PlaceForDPSVisitor::PlaceForDPSVisitor(double distance) : place_(PlaceForWeapon::bow), distance_(distance) {}
 
@@ -22,23 +16,7 @@ void PlaceForDPSVisitor::visit(GuardShip* ship) {
         place_ = PlaceForWeapon::bow;
         return;
     }
-    std::vector<PlaceForWeapon> all_places = {PlaceForWeapon::bow, PlaceForWeapon::stern, PlaceForWeapon::port, PlaceForWeapon::starboard};
-    
-    double max_dps = 0.0;
-    PlaceForWeapon best_place = all_places[0];
-    for (auto place : all_places) {
-        if (ship->has_weapon_in_place(place)) {
-            IWeapon* weapon = ship->get_weapon_in_place(place);
-            if (weapon && weapon->get_range() >= distance_) {
-                double dps = calculate_dps(weapon);
-                if (dps > max_dps) {
-                    max_dps = dps;
-                    best_place = place;
-                }
-            }
-        }
-    }
-    place_ = best_place;
+    place_ = ship->best_place_by_dps(distance_).value_or(PlaceForWeapon::bow);
     has_place_ = true;
 }
 
@@ -47,23 +25,7 @@ void PlaceForDPSVisitor::visit(WarShip* ship) {
         place_ = PlaceForWeapon::bow;
         return;
     }
-    std::vector<PlaceForWeapon> all_places = {PlaceForWeapon::bow, PlaceForWeapon::stern, PlaceForWeapon::port, PlaceForWeapon::starboard};
-    
-    double max_dps = 0.0;
-    PlaceForWeapon best_place = all_places[0];
-    for (auto place : all_places) {
-        if (ship->has_weapon_in_place(place)) {
-            IWeapon* weapon = ship->get_weapon_in_place(place);
-            if (weapon && weapon->get_range() >= distance_) {
-                double dps = calculate_dps(weapon);
-                if (dps > max_dps) {
-                    max_dps = dps;
-                    best_place = place;
-                }
-            }
-        }
-    }
-    place_ = best_place;
+    place_ = ship->best_place_by_dps(distance_).value_or(PlaceForWeapon::bow);
     has_place_ = true;
 }
 
@@ -18,13 +18,6 @@ class PlaceForDPSVisitor : public IShipVisitor {
         PlaceForWeapon place_; ///< Выбранное место для оружия
         double distance_; ///< Расстояние до цели
         bool has_place_ = false; ///< Флаг наличия подходящего места
-        
-        /**
-         * @brief Вычисляет DPS (урон в секунду) оружия
-         * @param weapon Указатель на оружие
-         * @return double DPS оружия
-         */
-        double calculate_dps(IWeapon* weapon) const;
     public:
         /**
          * @brief Конструктор
@@ -25,47 +25,26 @@ void ShootingVisitor::visit(TransportShip* ship) {
 }
 
 void ShootingVisitor::visit(GuardShip* ship) {
-    shot_fired_ = false;
-
-    if (!can_ship_shoot(ship)) return;
-
-    IWeapon* weapon = ship->get_weapon_in_place(place_);
-    if (!weapon) return;
-    if (weapon->get_current_ammo() == 0) return;
-
-    double distance = calculate_distance(ship);
-    if (distance > weapon->get_range()) return;
-
-    double damage_result = damage_service_.calculate_damage(weapon, target_ship_, distance);
-
-    target_ship_->take_damage(damage_result);
-    shot_fired_ = true;
-
-    size_t current_ammo = weapon->get_current_ammo();
-    if (current_ammo > 0) weapon->set_current_ammo(current_ammo - 1);
+    shot_fired_ = can_ship_shoot(ship) && fire(*ship, place_, target_ship_, damage_service_, calculate_distance(ship)).has_value();
 }
 
 void ShootingVisitor::visit(WarShip* ship) {
-    shot_fired_ = false;
-
-    if (!can_ship_shoot(ship)) return;
-
-    IWeapon* weapon = ship->get_weapon_in_place(place_);
-    if (!weapon) return;
-    if (weapon->get_current_ammo() == 0) return;
-
-    double distance = calculate_distance(ship);
-    if (distance > weapon->get_range()) return;
-
-    double damage_result = damage_service_.calculate_damage(weapon, target_ship_, distance);
-
-    target_ship_->take_damage(damage_result);
-    shot_fired_ = true;
-
-    size_t current_ammo = weapon->get_current_ammo();
-    if (current_ammo > 0) weapon->set_current_ammo(current_ammo - 1);
+    shot_fired_ = can_ship_shoot(ship) && fire(*ship, place_, target_ship_, damage_service_, calculate_distance(ship)).has_value();
 }
 
 bool ShootingVisitor::shot_fired() const {
     return shot_fired_;
+}
+
+std::optional<double> ShootingVisitor::fire(DefaultGuard& guard, PlaceForWeapon place, IShip* target, DamageService& damage_service, double distance) {
+    const IWeapon* weapon = guard.get_weapon_in_place(place);
+    if (!weapon) return std::nullopt;
+    if (weapon->get_current_ammo() == 0) return std::nullopt;
+    if (distance > weapon->get_range()) return std::nullopt;
+
+    double damage_result = damage_service.calculate_damage(weapon, target, distance);
+    target->take_damage(damage_result);
+
+    guard.consume_ammo(place);
+    return damage_result;
 }
\ No newline at end of file
@@ -8,6 +8,8 @@
 #include "../IShipVisitor.hpp"
 #include "../../service/combat/DamageService.hpp"
 #include "../../auxiliary/PlaceForWeapon.hpp"
+#include "../../entity/ship/Abstracts/DefaultGuard.hpp"
+#include <optional>
 
 /**
  * @class ShootingVisitor
@@ -56,4 +58,16 @@ class ShootingVisitor : public IShipVisitor {
          * @return bool true если выстрел выполнен, false в противном случае
          */
         bool shot_fired() const;
+
+        /**
+         * @brief Выполняет выстрел из оружия корабля без двойной диспетчеризации
+         * @details Проверяет боезапас и дальность, наносит урон и расходует снаряд. Живость кораблей не проверяется
+         * @param guard Вооружение атакующего корабля
+         * @param place Место оружия
+         * @param target Целевой корабль
+         * @param damage_service Сервис урона
+         * @param distance Расстояние до цели
+         * @return std::optional<double> Нанесенный цели урон (0.0 при промахе) или std::nullopt, если выстрел не выполнен
+         */
+        static std::optional<double> fire(DefaultGuard& guard, PlaceForWeapon place, IShip* target, DamageService& damage_service, double distance);
 };
\ No newline at end of file